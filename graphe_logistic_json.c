@@ -6,8 +6,34 @@
 #include "cJSON.h"
 #include <limits.h>
 #include <float.h> // Pour FLT_MAX
+#include <stdint.h>
+#include <math.h>
+#ifdef _OPENMP
+#include <omp.h> // Parallélisme (compiler avec -fopenmp ; sinon exécution séquentielle)
+#endif
+#ifdef __SSE2__
+#include <emmintrin.h> // Intrinsèques SSE2 (scanner CSV)
+#endif
+#ifdef __linux__
+#include <sys/mman.h> // madvise (pages de 2 Mo pour les grandes matrices de distances)
+#endif
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define HAVE_X86_DISPATCH 1 // Noyaux AVX2/SSE choisis à l'exécution selon le processeur
+#endif
 
 #define INF 1e9 // Représente l'infini
+#define PEAK_COST_FACTOR 1.2f // Majoration du coût aux heures de pointe
+#define COST_WEIGHT_SCALE 0.001f // Normalisation du coût monétaire dans le poids composite
+
+// Périodes de la journée pour les variations temporelles des arêtes
+typedef enum TimePeriod {
+    PERIOD_NORMAL = 0,    // journée hors pointe (facteur 1)
+    PERIOD_MORNING,       // pointe du matin (7h-9h)
+    PERIOD_AFTERNOON,     // pointe de l'après-midi (17h-19h)
+    PERIOD_NIGHT,         // nuit (22h-5h)
+    NUM_PERIODS
+} TimePeriod;
 
 // Structure pour les attributs d’une arête
 typedef struct EdgeAttr {
@@ -17,12 +43,16 @@ typedef struct EdgeAttr {
     int roadType;         // type de route (0: asphalte, 1: latérite, etc.)
     float reliability;    // indice de fiabilité [0,1]
     int restrictions;     // restrictions codées en bits
+    float timeVariation[NUM_PERIODS]; // facteur multiplicatif du temps par période
 } EdgeAttr;
 
 // Structure pour un nœud de la liste d’adjacence
 typedef struct AdjListNode {
     int dest;                     // identifiant du nœud destination
-    EdgeAttr attr;                // attributs de l’arête
+    int edge_id;                  // identifiant de l’arête (commun aux deux sens)
+    EdgeAttr attr;                // attributs nominaux de l’arête (jamais modifiés)
+    float effTime;                // temps effectif à l’heure courante
+    float effCost;                // coût effectif à l’heure courante
     struct AdjListNode* next;     // pointeur vers le prochain nœud
 } AdjListNode;
 
@@ -31,11 +61,16 @@ typedef struct AdjList {
     AdjListNode* head;            // tête de la liste
 } AdjList;
 
-// Structure pour le graphe
-typedef struct Graph {
-    int V;                        // nombre de sommets
-    AdjList* array;               // tableau des listes d’adjacence
-} Graph;
+#define ADJ_BLOCK_SIZE 4096 // Nombre minimal de nœuds alloués par bloc
+#define GRAPH_MAX_VERTICES (1 << 26) // Nombre maximal de sommets (identifiants lus dans les fichiers bornés)
+
+// Bloc de nœuds d’adjacence alloués en une seule fois
+typedef struct AdjListBlock {
+    struct AdjListBlock* next;    // bloc précédemment alloué
+    int size;                     // nombre de nœuds du bloc
+    int used;                     // nombre de nœuds déjà distribués
+    AdjListNode nodes[];          // nœuds contigus
+} AdjListBlock;
 
 // Structure pour un nœud du réseau
 typedef struct Node {
@@ -46,42 +81,909 @@ typedef struct Node {
     int capacity;
 } Node;
 
-// Fonction pour créer un nœud de la liste d’adjacence
-AdjListNode* create_adj_list_node(int dest, EdgeAttr attr) {
-    AdjListNode* newNode = (AdjListNode*)malloc(sizeof(AdjListNode));
+// Nœud d'un arbre de tournée eulérienne (arbre splay ordonné selon la tournée)
+// Un nœud sommet représente un sommet de la forêt d'un niveau, un nœud arc un sens d'une arête
+// de cette forêt ; chaque arbre splay porte la tournée d'un arbre de la forêt.
+typedef struct EttNode {
+    struct EttNode* left;
+    struct EttNode* right;
+    struct EttNode* parent;
+    struct EttNode* twin;         // arc : arc de sens opposé au même niveau
+    struct EttNode* upper;        // arc : même arc au niveau suivant (NULL au niveau de l'arête)
+    int vertex;                   // sommet représenté (-1 pour un arc)
+    int edge;                     // arête représentée (-1 pour un sommet)
+    int vertices;                 // nombre de nœuds sommets du sous-arbre
+    unsigned char flags;          // indicateurs ETT_* du nœud
+    unsigned char subtreeFlags;   // union des indicateurs du sous-arbre
+} EttNode;
+
+#define ETT_TREE_EDGE 1     // arc (u -> v) d'une arête de la forêt dont le niveau est celui de l'arbre
+#define ETT_NON_TREE 2      // sommet ayant des arêtes hors forêt de ce niveau
+#define ETT_BLOCK_SIZE 1024 // Nombre de nœuds de tournée alloués par bloc
+
+// Bloc de nœuds de tournée alloués en une seule fois
+typedef struct EttNodeBlock {
+    struct EttNodeBlock* next;    // bloc précédemment alloué
+    EttNode nodes[ETT_BLOCK_SIZE];
+} EttNodeBlock;
+
+// Niveau i de la hiérarchie : forêt F_i des arêtes de la forêt de niveau >= i
+typedef struct ConnectivityLevel {
+    EttNode** loop;               // nœud sommet de chaque sommet (NULL : sommet isolé dans F_i)
+    int* nonTreeHead;             // première arête hors forêt de niveau i de chaque sommet (-1 : aucune)
+} ConnectivityLevel;
+
+#define CONN_EDGE_NONE 0     // arête absente ou boucle (sans effet sur la connectivité)
+#define CONN_EDGE_NON_TREE 1 // arête hors forêt
+#define CONN_EDGE_TREE 2     // arête de la forêt couvrante
+
+// État d'une arête pour le suivi de connectivité (indexé par edge_id)
+typedef struct ConnectivityEdge {
+    int u;
+    int v;
+    int level;                    // niveau de l'arête (0 à l'insertion, ne fait que croître)
+    int state;                    // CONN_EDGE_NONE, CONN_EDGE_NON_TREE ou CONN_EDGE_TREE
+    int next[2];                  // arête hors forêt suivante dans la liste de u (0) et de v (1)
+    int prev[2];                  // arête hors forêt précédente (-1 : tête de liste)
+    EttNode* arc;                 // arc u -> v dans F_0 (arête de la forêt)
+} ConnectivityEdge;
+
+// Connectivité tenue à jour au fil des modifications du graphe (voir enable_connectivity_tracking)
+// Schéma de Holm, de Lichtenberg et Thorup : chaque arête a un niveau, F_i est la forêt couvrante
+// des arêtes de niveau >= i et chaque arbre de F_i compte au plus V / 2^i sommets. Les forêts
+// sont des arbres de tournée eulérienne ; une arête examinée sans succès lors d'une recherche de
+// remplacement monte d'un niveau, ce qui borne le coût amorti d'une suppression.
+typedef struct Connectivity {
+    int components;               // nombre de composantes connexes
+    int vertexCapacity;           // taille allouée des tableaux par sommet
+    int levelCount;               // nombre de niveaux alloués
+    ConnectivityLevel* levels;
+    ConnectivityEdge* edges;      // état de chaque arête (par edge_id)
+    int edgeCapacity;
+    EttNodeBlock* blocks;         // blocs de nœuds de tournée
+    int blockUsed;                // nœuds déjà distribués dans le premier bloc
+    EttNode* freeNodes;           // nœuds libérés (chaînés par parent), réutilisés en priorité
+} Connectivity;
+
+// Structure pour le graphe
+typedef struct Graph {
+    int V;                        // nombre de sommets
+    int capacity;                 // nombre de listes d’adjacence allouées (>= V)
+    AdjList* array;               // tableau des listes d’adjacence
+    AdjListBlock* blocks;         // blocs de nœuds d’adjacence
+    AdjListNode* free_nodes;      // nœuds libérés, réutilisés en priorité
+    int next_edge_id;             // prochain identifiant d’arête à attribuer
+    Connectivity* connectivity;   // suivi incrémental de la connectivité (NULL : désactivé)
+    int edge_count;               // nombre d’arêtes (tenu à jour par add_edge / remove_edge)
+    int* degree;                  // degré de chaque sommet (capacity)
+    int* degree_histogram;        // nombre de sommets de chaque degré (histogram_capacity)
+    int histogram_capacity;
+    int min_degree;               // plus petit degré (0 si aucun sommet)
+    int max_degree;               // plus grand degré
+    Node* nodes;                  // description de chaque sommet (nom, type, coordonnées, capacité)
+} Graph;
+
+// Structure pour une arête à insérer en masse
+typedef struct EdgeRecord {
+    int src;
+    int dest;
+    EdgeAttr attr;
+} EdgeRecord;
+
+// Représentation compacte (CSR) du graphe, en lecture seule
+// Les arcs sortants du sommet v occupent les indices [offsets[v], offsets[v + 1]).
+// Chaque attribut est stocké dans sa propre colonne contiguë, indexée par arc.
+typedef struct CSRGraph {
+    int V;                        // nombre de sommets
+    int E;                        // nombre d’arêtes (non orientées)
+    int A;                        // nombre d’arcs (deux par arête)
+    int* offsets;                 // début des arcs de chaque sommet (V + 1)
+    int* targets;                 // sommet destination de chaque arc
+    int* edge_ids;                // arête d’origine de chaque arc, dans [0, E)
+    float* distance;
+    float* baseTime;
+    float* cost;
+    float* reliability;
+    int* roadType;
+    int* restrictions;
+    int* nodeCapacity;            // capacité de chaque sommet (V ; 0 : non limitée)
+    float* timeVariation[NUM_PERIODS];  // facteur de chaque arc par période
+    float* periodWeights[NUM_PERIODS];  // poids effectifs précalculés (NULL avant calcul)
+    float* effTime;               // temps effectif à l’heure courante (NULL avant calcul)
+    float* effCost;               // coût effectif à l’heure courante (NULL avant calcul)
+    const uint64_t* arcFilter;    // arcs autorisés (1 bit par arc), NULL : tous les arcs
+} CSRGraph;
+
+// Teste si l’arc a est autorisé par le filtre de la vue CSR
+#define CSR_ARC_ALLOWED(csr, a) ((csr)->arcFilter == NULL || (((csr)->arcFilter[(a) >> 6] >> ((a) & 63)) & 1))
+
+// Bits de restriction des arêtes (champ EdgeAttr.restrictions)
+#define RESTRICTION_NO_HEAVY      (1 << 0) // interdit aux véhicules de plus de 3,5 t
+#define RESTRICTION_LOW_CLEARANCE (1 << 1) // hauteur limitée (pont, tunnel)
+#define RESTRICTION_NO_HAZMAT     (1 << 2) // matières dangereuses interdites
+
+// Teste si un arc des listes d'adjacence est autorisé par un masque de restrictions interdites
+#define ADJ_ARC_ALLOWED(node, forbiddenMask) (((node)->attr.restrictions & (forbiddenMask)) == 0)
+
+// Classes de véhicules routées sur le même réseau
+typedef enum VehicleClass {
+    VEHICLE_MOTORBIKE = 0,
+    VEHICLE_VAN,
+    VEHICLE_LIGHT_TRUCK,
+    VEHICLE_HEAVY_TRUCK,
+    VEHICLE_TANKER,
+    NUM_VEHICLE_CLASSES
+} VehicleClass;
+
+// Fonction pour déterminer la période de la journée correspondant à une heure
+TimePeriod get_time_period(int hour) {
+    hour = ((hour % 24) + 24) % 24;
+    if (hour >= 7 && hour <= 9) {
+        return PERIOD_MORNING;
+    }
+    if (hour >= 17 && hour <= 19) {
+        return PERIOD_AFTERNOON;
+    }
+    if (hour >= 22 || hour <= 5) {
+        return PERIOD_NIGHT;
+    }
+    return PERIOD_NORMAL;
+}
+
+// Fonction pour initialiser les variations temporelles par défaut d'une arête
+// (+50% aux heures de pointe, -20% la nuit)
+void set_default_time_variation(EdgeAttr* attr) {
+    attr->timeVariation[PERIOD_NORMAL] = 1.0f;
+    attr->timeVariation[PERIOD_MORNING] = 1.5f;
+    attr->timeVariation[PERIOD_AFTERNOON] = 1.5f;
+    attr->timeVariation[PERIOD_NIGHT] = 0.8f;
+}
+
+// Fonction pour réserver au moins n nœuds d’adjacence libres dans le dernier bloc
+// Retourne false (graphe inchangé) si le bloc ne peut pas être alloué.
+bool reserve_adj_list_nodes(Graph* graph, int n) {
+    AdjListBlock* block = graph->blocks;
+    if (block != NULL && block->size - block->used >= n) {
+        return true;
+    }
+
+    int size = (n > ADJ_BLOCK_SIZE) ? n : ADJ_BLOCK_SIZE;
+    block = (AdjListBlock*)malloc(sizeof(AdjListBlock) + (size_t)size * sizeof(AdjListNode));
+    if (block == NULL) {
+        fprintf(stderr, "Erreur : Mémoire insuffisante pour %d nœuds d’adjacence.\n", size);
+        return false;
+    }
+    block->size = size;
+    block->used = 0;
+    block->next = graph->blocks;
+    graph->blocks = block;
+    return true;
+}
+
+// Fonction pour créer un nœud de la liste d’adjacence (NULL si la mémoire manque)
+AdjListNode* create_adj_list_node(Graph* graph, int dest, EdgeAttr attr) {
+    AdjListNode* newNode = graph->free_nodes;
+    if (newNode != NULL) {
+        // Réutiliser un nœud libéré par remove_edge / remove_node
+        graph->free_nodes = newNode->next;
+    } else {
+        if (!reserve_adj_list_nodes(graph, 1)) {
+            return NULL;
+        }
+        newNode = &graph->blocks->nodes[graph->blocks->used++];
+    }
     newNode->dest = dest;
+    newNode->edge_id = -1;
     newNode->attr = attr;
+    newNode->effTime = attr.baseTime;
+    newNode->effCost = attr.cost;
     newNode->next = NULL;
     return newNode;
 }
 
-// Fonction pour créer un graphe avec V sommets
-Graph* create_graph(int V) {
-    Graph* graph = (Graph*)malloc(sizeof(Graph));
-    graph->V = V;
+// Fonction pour rendre un nœud d’adjacence au graphe (il sera réutilisé)
+void release_adj_list_node(Graph* graph, AdjListNode* node) {
+    node->next = graph->free_nodes;
+    graph->free_nodes = node;
+}
+
+// Fonction pour allouer un nœud de tournée (sommet si vertex >= 0, arc sinon)
+EttNode* ett_new_node(Connectivity* conn, int vertex, int edge) {
+    EttNode* node = conn->freeNodes;
+    if (node != NULL) {
+        conn->freeNodes = node->parent;
+    } else {
+        if (conn->blocks == NULL || conn->blockUsed == ETT_BLOCK_SIZE) {
+            EttNodeBlock* block = (EttNodeBlock*)malloc(sizeof(EttNodeBlock));
+            block->next = conn->blocks;
+            conn->blocks = block;
+            conn->blockUsed = 0;
+        }
+        node = &conn->blocks->nodes[conn->blockUsed++];
+    }
+    node->left = node->right = node->parent = NULL;
+    node->twin = node->upper = NULL;
+    node->vertex = vertex;
+    node->edge = edge;
+    node->vertices = (vertex >= 0) ? 1 : 0;
+    node->flags = 0;
+    node->subtreeFlags = 0;
+    return node;
+}
 
-    // Créer un tableau de listes d’adjacence
-    graph->array = (AdjList*)malloc(V * sizeof(AdjList));
+// Fonction pour rendre un nœud de tournée (il sera réutilisé)
+void ett_release_node(Connectivity* conn, EttNode* node) {
+    node->parent = conn->freeNodes;
+    conn->freeNodes = node;
+}
 
-    // Initialiser chaque liste d’adjacence comme vide
-    for (int i = 0; i < V; i++) {
+// Fonction pour recalculer les agrégats d'un nœud à partir de ses enfants
+void ett_update(EttNode* x) {
+    x->vertices = (x->vertex >= 0) ? 1 : 0;
+    x->subtreeFlags = x->flags;
+    if (x->left != NULL) {
+        x->vertices += x->left->vertices;
+        x->subtreeFlags |= x->left->subtreeFlags;
+    }
+    if (x->right != NULL) {
+        x->vertices += x->right->vertices;
+        x->subtreeFlags |= x->right->subtreeFlags;
+    }
+}
+
+// Fonction pour remonter x d'un cran (rotation simple)
+void ett_rotate(EttNode* x) {
+    EttNode* p = x->parent;
+    EttNode* g = p->parent;
+    if (p->left == x) {
+        p->left = x->right;
+        if (x->right != NULL) {
+            x->right->parent = p;
+        }
+        x->right = p;
+    } else {
+        p->right = x->left;
+        if (x->left != NULL) {
+            x->left->parent = p;
+        }
+        x->left = p;
+    }
+    p->parent = x;
+    x->parent = g;
+    if (g != NULL) {
+        if (g->left == p) {
+            g->left = x;
+        } else {
+            g->right = x;
+        }
+    }
+    ett_update(p);
+    ett_update(x);
+}
+
+// Fonction pour amener x à la racine de son arbre splay
+void ett_splay(EttNode* x) {
+    while (x->parent != NULL) {
+        EttNode* p = x->parent;
+        EttNode* g = p->parent;
+        if (g != NULL) {
+            // zig-zig : rotation du parent d'abord ; zig-zag : deux rotations de x
+            ett_rotate(((g->left == p) == (p->left == x)) ? p : x);
+        }
+        ett_rotate(x);
+    }
+}
+
+// Fonction pour concaténer deux tournées (racines a et b, NULL : vide) ; retourne la racine
+EttNode* ett_merge(EttNode* a, EttNode* b) {
+    if (a == NULL) {
+        return b;
+    }
+    if (b == NULL) {
+        return a;
+    }
+    EttNode* last = a;
+    while (last->right != NULL) {
+        last = last->right;
+    }
+    ett_splay(last);
+    last->right = b;
+    b->parent = last;
+    ett_update(last);
+    return last;
+}
+
+// Fonction pour faire commencer la tournée de l'arbre de x au nœud sommet x ; retourne la racine
+EttNode* ett_reroot(EttNode* x) {
+    ett_splay(x);
+    EttNode* before = x->left;
+    if (before == NULL) {
+        return x;
+    }
+    x->left = NULL;
+    before->parent = NULL;
+    ett_update(x);
+    return ett_merge(x, before);
+}
+
+// Fonction pour tester si deux nœuds appartiennent au même arbre
+// Après splay(y), x n'est plus une racine que s'il partage l'arbre de y.
+bool ett_same_tree(EttNode* x, EttNode* y) {
+    if (x == y) {
+        return true;
+    }
+    ett_splay(x);
+    ett_splay(y);
+    return x->parent != NULL;
+}
+
+// Fonction pour obtenir le nombre de sommets de l'arbre contenant x
+int ett_tree_vertices(EttNode* x) {
+    ett_splay(x);
+    return x->vertices;
+}
+
+// Fonction pour activer ou retirer un indicateur d'un nœud
+void ett_set_flag(EttNode* x, unsigned char flag, bool on) {
+    ett_splay(x);
+    if (on) {
+        x->flags |= flag;
+    } else {
+        x->flags &= (unsigned char)~flag;
+    }
+    ett_update(x);
+}
+
+// Fonction pour trouver un nœud portant l'indicateur flag dans l'arbre contenant x (NULL : aucun)
+EttNode* ett_find_flag(EttNode* x, unsigned char flag) {
+    ett_splay(x);
+    if (!(x->subtreeFlags & flag)) {
+        return NULL;
+    }
+    while (!(x->flags & flag)) {
+        x = (x->left != NULL && (x->left->subtreeFlags & flag)) ? x->left : x->right;
+    }
+    ett_splay(x);
+    return x;
+}
+
+// Fonction pour retirer l'arc a et son jumeau de leur tournée
+// La tournée « A a B a' C » devient les deux tournées B et A C.
+void ett_cut(Connectivity* conn, EttNode* a) {
+    EttNode* b = a->twin;
+    ett_splay(a);
+    EttNode* before = a->left;
+    EttNode* after = a->right;
+    if (before != NULL) {
+        before->parent = NULL;
+    }
+    if (after != NULL) {
+        after->parent = NULL;
+    }
+
+    EttNode* root = b;
+    while (root->parent != NULL) {
+        root = root->parent;
+    }
+    ett_splay(b);
+    EttNode* left = b->left;
+    EttNode* right = b->right;
+    if (left != NULL) {
+        left->parent = NULL;
+    }
+    if (right != NULL) {
+        right->parent = NULL;
+    }
+    if (root == after) {
+        ett_merge(before, right);  // b suit a : left est la tournée détachée
+    } else {
+        ett_merge(left, after);    // b précède a : right est la tournée détachée
+    }
+    ett_release_node(conn, a);
+    ett_release_node(conn, b);
+}
+
+// Fonction pour créer une structure de connectivité vide
+Connectivity* create_connectivity(void) {
+    Connectivity* conn = (Connectivity*)calloc(1, sizeof(Connectivity));
+    return conn;
+}
+
+// Fonction pour libérer une structure de connectivité
+void free_connectivity(Connectivity* conn) {
+    if (conn == NULL) {
+        return;
+    }
+    for (int i = 0; i < conn->levelCount; i++) {
+        free(conn->levels[i].loop);
+        free(conn->levels[i].nonTreeHead);
+    }
+    free(conn->levels);
+    free(conn->edges);
+    EttNodeBlock* block = conn->blocks;
+    while (block) {
+        EttNodeBlock* temp = block;
+        block = block->next;
+        free(temp);
+    }
+    free(conn);
+}
+
+// Fonction pour garantir que le niveau level existe (forêt vide)
+// Les arbres de F_i comptant au plus V / 2^i sommets, il y a au plus log2(V) + 1 niveaux.
+void connectivity_reserve_level(Connectivity* conn, int level) {
+    if (level < conn->levelCount) {
+        return;
+    }
+    conn->levels = (ConnectivityLevel*)realloc(conn->levels, (level + 1) * sizeof(ConnectivityLevel));
+    for (int i = conn->levelCount; i <= level; i++) {
+        int capacity = (conn->vertexCapacity > 0) ? conn->vertexCapacity : 1;
+        conn->levels[i].loop = (EttNode**)calloc(capacity, sizeof(EttNode*));
+        conn->levels[i].nonTreeHead = (int*)malloc(capacity * sizeof(int));
+        for (int v = 0; v < capacity; v++) {
+            conn->levels[i].nonTreeHead[v] = -1;
+        }
+    }
+    conn->levelCount = level + 1;
+}
+
+// Fonction pour ajouter les sommets [from, to) comme composantes isolées
+void connectivity_add_vertices(Connectivity* conn, int from, int to) {
+    connectivity_reserve_level(conn, 0);
+    if (to > conn->vertexCapacity) {
+        int capacity = (conn->vertexCapacity > 0) ? conn->vertexCapacity : 16;
+        while (capacity < to) {
+            capacity *= 2;
+        }
+        for (int i = 0; i < conn->levelCount; i++) {
+            ConnectivityLevel* level = &conn->levels[i];
+            level->loop = (EttNode**)realloc(level->loop, capacity * sizeof(EttNode*));
+            level->nonTreeHead = (int*)realloc(level->nonTreeHead, capacity * sizeof(int));
+        }
+        conn->vertexCapacity = capacity;
+    }
+    for (int i = 0; i < conn->levelCount; i++) {
+        for (int v = from; v < to; v++) {
+            conn->levels[i].loop[v] = NULL;
+            conn->levels[i].nonTreeHead[v] = -1;
+        }
+    }
+    conn->components += to - from;
+}
+
+// Fonction pour garantir que l'état de l'arête edge_id existe
+void connectivity_reserve_edges(Connectivity* conn, int edge_id) {
+    if (edge_id < conn->edgeCapacity) {
+        return;
+    }
+    int capacity = (conn->edgeCapacity > 0) ? conn->edgeCapacity : 64;
+    while (capacity <= edge_id) {
+        capacity *= 2;
+    }
+    conn->edges = (ConnectivityEdge*)realloc(conn->edges, capacity * sizeof(ConnectivityEdge));
+    memset(conn->edges + conn->edgeCapacity, 0, (capacity - conn->edgeCapacity) * sizeof(ConnectivityEdge));
+    conn->edgeCapacity = capacity;
+}
+
+// Fonction pour obtenir le nœud sommet de v au niveau level (créé s'il est isolé)
+EttNode* connectivity_loop(Connectivity* conn, int level, int v) {
+    EttNode** loop = &conn->levels[level].loop[v];
+    if (*loop == NULL) {
+        *loop = ett_new_node(conn, v, -1);
+    }
+    return *loop;
+}
+
+// Fonction pour relier les arbres des extrémités d'une arête dans F_level ; retourne l'arc u -> v
+// La tournée de u (commençant en u), l'arc u -> v, la tournée de v puis l'arc v -> u sont concaténés.
+EttNode* connectivity_link(Connectivity* conn, int level, int edge) {
+    ConnectivityEdge* e = &conn->edges[edge];
+    EttNode* tourU = ett_reroot(connectivity_loop(conn, level, e->u));
+    EttNode* tourV = ett_reroot(connectivity_loop(conn, level, e->v));
+    EttNode* forward = ett_new_node(conn, -1, edge);
+    EttNode* backward = ett_new_node(conn, -1, edge);
+    forward->twin = backward;
+    backward->twin = forward;
+    ett_merge(ett_merge(ett_merge(tourU, forward), tourV), backward);
+    return forward;
+}
+
+// Fonction pour obtenir la position de x dans les listes d'une arête (0 : côté u, 1 : côté v)
+int connectivity_side(const ConnectivityEdge* e, int x) {
+    return (e->u == x) ? 0 : 1;
+}
+
+// Fonction pour ranger une arête hors forêt au niveau level (listes de ses deux extrémités)
+void connectivity_insert_non_tree(Connectivity* conn, int edge, int level) {
+    ConnectivityEdge* e = &conn->edges[edge];
+    int* head = conn->levels[level].nonTreeHead;
+    e->state = CONN_EDGE_NON_TREE;
+    e->level = level;
+    for (int side = 0; side < 2; side++) {
+        int x = (side == 0) ? e->u : e->v;
+        int first = head[x];
+        e->next[side] = first;
+        e->prev[side] = -1;
+        if (first >= 0) {
+            conn->edges[first].prev[connectivity_side(&conn->edges[first], x)] = edge;
+        } else {
+            ett_set_flag(connectivity_loop(conn, level, x), ETT_NON_TREE, true);
+        }
+        head[x] = edge;
+    }
+}
+
+// Fonction pour retirer une arête hors forêt des listes de son niveau
+void connectivity_remove_non_tree(Connectivity* conn, int edge) {
+    ConnectivityEdge* e = &conn->edges[edge];
+    ConnectivityLevel* level = &conn->levels[e->level];
+    for (int side = 0; side < 2; side++) {
+        int x = (side == 0) ? e->u : e->v;
+        int next = e->next[side];
+        int prev = e->prev[side];
+        if (prev >= 0) {
+            conn->edges[prev].next[connectivity_side(&conn->edges[prev], x)] = next;
+        } else {
+            level->nonTreeHead[x] = next;
+        }
+        if (next >= 0) {
+            conn->edges[next].prev[connectivity_side(&conn->edges[next], x)] = prev;
+        }
+        if (level->nonTreeHead[x] < 0) {
+            ett_set_flag(level->loop[x], ETT_NON_TREE, false);
+        }
+    }
+    e->state = CONN_EDGE_NONE;
+}
+
+// Fonction pour monter d'un niveau une arête de la forêt de niveau level (arc : son arc dans F_level)
+void connectivity_promote_tree_edge(Connectivity* conn, EttNode* arc, int level) {
+    int edge = arc->edge;
+    ett_set_flag(arc, ETT_TREE_EDGE, false);
+    connectivity_reserve_level(conn, level + 1);
+    EttNode* upper = connectivity_link(conn, level + 1, edge);
+    ett_set_flag(upper, ETT_TREE_EDGE, true);
+    arc->upper = upper;
+    conn->edges[edge].level = level + 1;
+}
+
+// Fonction pour chercher, au niveau level, une arête reconnectant les arbres de u et de v
+// Les arêtes de la forêt de niveau level du plus petit arbre montent d'abord d'un niveau ;
+// ses arêtes hors forêt de niveau level sont ensuite examinées : une arête qui sort de l'arbre
+// devient l'arête de remplacement, les autres montent d'un niveau.
+bool connectivity_find_replacement(Connectivity* conn, int u, int v, int level) {
+    EttNode* small = conn->levels[level].loop[u];
+    EttNode* large = conn->levels[level].loop[v];
+    if (ett_tree_vertices(small) > ett_tree_vertices(large)) {
+        small = large;
+    }
+
+    EttNode* found;
+    while ((found = ett_find_flag(small, ETT_TREE_EDGE)) != NULL) {
+        connectivity_promote_tree_edge(conn, found, level);
+    }
+
+    while ((found = ett_find_flag(small, ETT_NON_TREE)) != NULL) {
+        int x = found->vertex;
+        while (conn->levels[level].nonTreeHead[x] >= 0) {
+            int edge = conn->levels[level].nonTreeHead[x];
+            ConnectivityEdge* e = &conn->edges[edge];
+            int y = (e->u == x) ? e->v : e->u;
+            connectivity_remove_non_tree(conn, edge);
+
+            if (!ett_same_tree(conn->levels[level].loop[x], conn->levels[level].loop[y])) {
+                // Arête de remplacement : elle entre dans F_0 ... F_level
+                e->state = CONN_EDGE_TREE;
+                e->level = level;
+                EttNode* below = NULL;
+                for (int i = 0; i <= level; i++) {
+                    EttNode* arc = connectivity_link(conn, i, edge);
+                    if (below == NULL) {
+                        e->arc = arc;
+                    } else {
+                        below->upper = arc;
+                    }
+                    below = arc;
+                }
+                ett_set_flag(below, ETT_TREE_EDGE, true);
+                return true;
+            }
+            // Les deux extrémités sont dans le petit arbre : l'arête monte d'un niveau
+            connectivity_reserve_level(conn, level + 1);
+            connectivity_insert_non_tree(conn, edge, level + 1);
+        }
+    }
+    return false;
+}
+
+// Fonction pour mettre à jour la connectivité après l'ajout de l'arête (src, dest)
+// L'arête entre au niveau 0 : dans la forêt si elle relie deux composantes, hors forêt sinon.
+void connectivity_on_add_edge(Graph* graph, int src, int dest, int edge_id) {
+    Connectivity* conn = graph->connectivity;
+    connectivity_reserve_edges(conn, edge_id);
+    ConnectivityEdge* e = &conn->edges[edge_id];
+    e->u = src;
+    e->v = dest;
+    e->level = 0;
+    e->state = CONN_EDGE_NONE;
+    e->arc = NULL;
+    if (src == dest) {
+        return; // une boucle ne change pas la connectivité
+    }
+
+    EttNode* loopSrc = conn->levels[0].loop[src];
+    EttNode* loopDest = conn->levels[0].loop[dest];
+    if (loopSrc != NULL && loopDest != NULL && ett_same_tree(loopSrc, loopDest)) {
+        connectivity_insert_non_tree(conn, edge_id, 0);
+        return;
+    }
+    e->state = CONN_EDGE_TREE;
+    e->arc = connectivity_link(conn, 0, edge_id);
+    ett_set_flag(e->arc, ETT_TREE_EDGE, true);
+    conn->components--;
+}
+
+// Fonction pour mettre à jour la connectivité après la suppression de l'arête (src, dest)
+// Une arête hors forêt est retirée de ses listes. Une arête de la forêt de niveau l est coupée
+// dans F_0 ... F_l, puis un remplacement est cherché du niveau l au niveau 0 ; sans
+// remplacement, la composante est scindée.
+void connectivity_on_remove_edge(Graph* graph, int src, int dest, int edge_id) {
+    Connectivity* conn = graph->connectivity;
+    (void)src;
+    (void)dest;
+    if (edge_id >= conn->edgeCapacity) {
+        return;
+    }
+    ConnectivityEdge* e = &conn->edges[edge_id];
+    if (e->state == CONN_EDGE_NON_TREE) {
+        connectivity_remove_non_tree(conn, edge_id);
+        return;
+    }
+    if (e->state != CONN_EDGE_TREE) {
+        return;
+    }
+    e->state = CONN_EDGE_NONE;
+    int u = e->u;
+    int v = e->v;
+    int level = e->level;
+    EttNode* arc = e->arc;
+    while (arc != NULL) {
+        EttNode* upper = arc->upper;
+        ett_cut(conn, arc);
+        arc = upper;
+    }
+    e->arc = NULL;
+
+    for (int i = level; i >= 0; i--) {
+        if (connectivity_find_replacement(conn, u, v, i)) {
+            return;
+        }
+    }
+    conn->components++;
+}
+
+// Fonction pour activer le suivi incrémental de la connectivité d'un graphe
+// La structure est construite une fois en O(V + E log V) amorti, puis tenue à jour par
+// add_edge, remove_edge et remove_node.
+void enable_connectivity_tracking(Graph* graph) {
+    if (graph->connectivity != NULL) {
+        return;
+    }
+    graph->connectivity = create_connectivity();
+    connectivity_add_vertices(graph->connectivity, 0, graph->V);
+    connectivity_reserve_edges(graph->connectivity, graph->next_edge_id);
+
+    for (int u = 0; u < graph->V; u++) {
+        for (AdjListNode* current = graph->array[u].head; current != NULL; current = current->next) {
+            // Chaque arête apparaît dans les deux listes : la traiter une seule fois
+            if (u < current->dest) {
+                connectivity_on_add_edge(graph, u, current->dest, current->edge_id);
+            }
+        }
+    }
+}
+
+// Fonction pour tester si deux sommets sont connectés (suivi de connectivité requis)
+// Les deux sommets sont connectés s'ils appartiennent au même arbre de F_0 : O(log V) amorti.
+bool connectivity_connected(const Graph* graph, int u, int v) {
+    if (graph->connectivity == NULL) {
+        fprintf(stderr, "Erreur : Suivi de connectivité non activé.\n");
+        return false;
+    }
+    if (u == v) {
+        return true;
+    }
+    EttNode* loopU = graph->connectivity->levels[0].loop[u];
+    EttNode* loopV = graph->connectivity->levels[0].loop[v];
+    return loopU != NULL && loopV != NULL && ett_same_tree(loopU, loopV);
+}
+
+// Fonction pour obtenir le nombre de composantes connexes (suivi de connectivité requis)
+int connectivity_component_count(const Graph* graph) {
+    if (graph->connectivity == NULL) {
+        fprintf(stderr, "Erreur : Suivi de connectivité non activé.\n");
+        return -1;
+    }
+    return graph->connectivity->components;
+}
+
+// Fonction pour modifier le degré d'un sommet et tenir à jour l'histogramme des degrés
+// Les bornes min / max ne se déplacent que d'un cran par unité de degré : coût amorti O(1).
+void update_degree(Graph* graph, int v, int delta) {
+    int old = graph->degree[v];
+    int d = old + delta;
+    if (d >= graph->histogram_capacity) {
+        int capacity = graph->histogram_capacity * 2;
+        while (capacity <= d) {
+            capacity *= 2;
+        }
+        graph->degree_histogram = (int*)realloc(graph->degree_histogram, capacity * sizeof(int));
+        memset(graph->degree_histogram + graph->histogram_capacity, 0,
+               (capacity - graph->histogram_capacity) * sizeof(int));
+        graph->histogram_capacity = capacity;
+    }
+    graph->degree[v] = d;
+    graph->degree_histogram[old]--;
+    graph->degree_histogram[d]++;
+
+    if (d > graph->max_degree) {
+        graph->max_degree = d;
+    }
+    if (d < graph->min_degree) {
+        graph->min_degree = d;
+    }
+    while (graph->max_degree > 0 && graph->degree_histogram[graph->max_degree] == 0) {
+        graph->max_degree--;
+    }
+    while (graph->min_degree < graph->max_degree && graph->degree_histogram[graph->min_degree] == 0) {
+        graph->min_degree++;
+    }
+}
+
+// Fonction pour garantir que le graphe contient au moins V sommets
+// Retourne false (graphe inchangé) si V dépasse GRAPH_MAX_VERTICES ou si la mémoire manque.
+bool ensure_graph_vertices(Graph* graph, int V) {
+    if (V <= graph->V) {
+        return true;
+    }
+    if (V > GRAPH_MAX_VERTICES) {
+        fprintf(stderr, "Erreur : %d sommets demandés, au plus %d autorisés.\n", V, GRAPH_MAX_VERTICES);
+        return false;
+    }
+
+    if (V > graph->capacity) {
+        // Croissance géométrique pour amortir les réallocations (sans débordement : V <= GRAPH_MAX_VERTICES)
+        int capacity = (graph->capacity > 0) ? graph->capacity : 16;
+        while (capacity < V) {
+            capacity *= 2;
+        }
+        AdjList* array = (AdjList*)realloc(graph->array, (size_t)capacity * sizeof(AdjList));
+        if (array != NULL) {
+            graph->array = array;
+        }
+        int* degree = (int*)realloc(graph->degree, (size_t)capacity * sizeof(int));
+        if (degree != NULL) {
+            graph->degree = degree;
+        }
+        Node* nodes = (Node*)realloc(graph->nodes, (size_t)capacity * sizeof(Node));
+        if (nodes != NULL) {
+            graph->nodes = nodes;
+        }
+        if (array == NULL || degree == NULL || nodes == NULL) {
+            // Les tableaux déjà agrandis restent valides pour les graph->V premiers sommets
+            fprintf(stderr, "Erreur : Mémoire insuffisante pour %d sommets.\n", V);
+            return false;
+        }
+        graph->capacity = capacity;
+    }
+
+    for (int i = graph->V; i < V; i++) {
         graph->array[i].head = NULL;
+        graph->degree[i] = 0;
+        memset(&graph->nodes[i], 0, sizeof(Node));
+        graph->nodes[i].id = i;
+    }
+    // Les nouveaux sommets sont isolés
+    graph->degree_histogram[0] += V - graph->V;
+    graph->min_degree = 0;
+    if (graph->connectivity != NULL) {
+        connectivity_add_vertices(graph->connectivity, graph->V, V);
+    }
+    graph->V = V;
+    return true;
+}
+
+// Fonction pour créer un graphe avec V sommets
+Graph* create_graph(int V) {
+    Graph* graph = (Graph*)malloc(sizeof(Graph));
+    graph->V = 0;
+    graph->capacity = 0;
+    graph->array = NULL;
+    graph->blocks = NULL;
+    graph->free_nodes = NULL;
+    graph->next_edge_id = 0;
+    graph->connectivity = NULL;
+    graph->edge_count = 0;
+    graph->degree = NULL;
+    graph->nodes = NULL;
+    graph->histogram_capacity = 16;
+    graph->degree_histogram = (int*)calloc(graph->histogram_capacity, sizeof(int));
+    graph->min_degree = 0;
+    graph->max_degree = 0;
+
+    // Créer le tableau de listes d’adjacence, chacune initialement vide
+    if (!ensure_graph_vertices(graph, V)) {
+        free(graph->array);
+        free(graph->degree);
+        free(graph->nodes);
+        free(graph->degree_histogram);
+        free(graph);
+        return NULL;
     }
 
     return graph;
 }
 
 // Fonction pour ajouter une arête au graphe
-void add_edge(Graph* graph, int src, int dest, EdgeAttr attr) {
+// Retourne false (graphe inchangé) si les nœuds d’adjacence ne peuvent pas être alloués.
+bool add_edge(Graph* graph, int src, int dest, EdgeAttr attr) {
+    AdjListNode* forward = create_adj_list_node(graph, dest, attr);
+    if (forward == NULL) {
+        return false;
+    }
+    AdjListNode* backward = create_adj_list_node(graph, src, attr);
+    if (backward == NULL) {
+        release_adj_list_node(graph, forward);
+        return false;
+    }
+    int edge_id = graph->next_edge_id++;
+
     // Ajouter une arête de src à dest
-    AdjListNode* newNode = create_adj_list_node(dest, attr);
-    newNode->next = graph->array[src].head;
-    graph->array[src].head = newNode;
+    forward->edge_id = edge_id;
+    forward->next = graph->array[src].head;
+    graph->array[src].head = forward;
 
     // Ajouter une arête de dest à src (si le graphe est non orienté)
-    newNode = create_adj_list_node(src, attr);
-    newNode->next = graph->array[dest].head;
-    graph->array[dest].head = newNode;
+    backward->edge_id = edge_id;
+    backward->next = graph->array[dest].head;
+    graph->array[dest].head = backward;
+
+    graph->edge_count++;
+    update_degree(graph, src, 1);
+    update_degree(graph, dest, 1);
+    if (graph->connectivity != NULL) {
+        connectivity_on_add_edge(graph, src, dest, edge_id);
+    }
+    return true;
+}
+
+// Fonction pour ajouter un lot d’arêtes en une seule fois
+// Les sommets manquants sont créés et tous les nœuds d’adjacence sont pris dans un même bloc.
+// Retourne false (graphe inchangé) si les sommets ou les nœuds d’adjacence ne peuvent pas
+// être alloués : les nœuds manquants sont réservés avant toute modification.
+bool add_edges_bulk(Graph* graph, const EdgeRecord* edges, int count) {
+    int maxVertex = graph->V - 1;
+    for (int i = 0; i < count; i++) {
+        if (edges[i].src > maxVertex) maxVertex = edges[i].src;
+        if (edges[i].dest > maxVertex) maxVertex = edges[i].dest;
+    }
+
+    // Nœuds libérés réutilisables, puis bloc pour le reste
+    int needed = 2 * count;
+    for (AdjListNode* node = graph->free_nodes; node != NULL && needed > 0; node = node->next) {
+        needed--;
+    }
+    if (needed > 0 && !reserve_adj_list_nodes(graph, needed)) {
+        return false;
+    }
+    if (!ensure_graph_vertices(graph, maxVertex + 1)) {
+        return false;
+    }
+
+    for (int i = 0; i < count; i++) {
+        add_edge(graph, edges[i].src, edges[i].dest, edges[i].attr);
+    }
+    return true;
 }
 
 // Fonction pour supprimer une arête du graphe
@@ -95,22 +997,24 @@ void remove_edge(Graph* graph, int src, int dest) {
         current = current->next;
     }
 
-    if (current != NULL) {
-        if (prev == NULL) {
-            // Le nœud à supprimer est le premier de la liste
-            graph->array[src].head = current->next;
-        } else {
-            // Le nœud à supprimer est au milieu ou à la fin
-            prev->next = current->next;
-        }
-        free(current);
+    if (current == NULL) {
+        return;
     }
+    int edge_id = current->edge_id;
+    if (prev == NULL) {
+        // Le nœud à supprimer est le premier de la liste
+        graph->array[src].head = current->next;
+    } else {
+        // Le nœud à supprimer est au milieu ou à la fin
+        prev->next = current->next;
+    }
+    release_adj_list_node(graph, current);
 
-    // Supprimer l'arête de dest à src (si le graphe est non orienté)
+    // Supprimer l'arc jumeau de dest à src (même identifiant, en cas d'arêtes parallèles)
     current = graph->array[dest].head;
     prev = NULL;
 
-    while (current != NULL && current->dest != src) {
+    while (current != NULL && (current->dest != src || current->edge_id != edge_id)) {
         prev = current;
         current = current->next;
     }
@@ -121,48 +1025,46 @@ void remove_edge(Graph* graph, int src, int dest) {
         } else {
             prev->next = current->next;
         }
-        free(current);
+        release_adj_list_node(graph, current);
+    }
+
+    graph->edge_count--;
+    update_degree(graph, src, -1);
+    update_degree(graph, dest, -1);
+    if (graph->connectivity != NULL) {
+        connectivity_on_remove_edge(graph, src, dest, edge_id);
     }
 }
 
 // Fonction pour supprimer un nœud du graphe
+// Chaque arête incidente est supprimée avec son arc jumeau : seules les listes des voisins
+// sont parcourues, et les arêtes parallèles et boucles sont toutes retirées.
 void remove_node(Graph* graph, int node) {
-    // Supprimer toutes les arêtes pointant vers ce nœud
-    for (int v = 0; v < graph->V; v++) {
-        if (v != node) {
-            remove_edge(graph, v, node);
-        }
-    }
-
-    // Supprimer toutes les arêtes sortantes de ce nœud
-    AdjListNode* current = graph->array[node].head;
-    while (current != NULL) {
-        AdjListNode* temp = current;
-        current = current->next;
-        free(temp);
+    while (graph->array[node].head != NULL) {
+        remove_edge(graph, node, graph->array[node].head->dest);
     }
-    graph->array[node].head = NULL;
 
     // Optionnel : Marquer le nœud comme supprimé (si nécessaire)
     // Par exemple, on peut utiliser un tableau booléen pour indiquer si un nœud est actif ou non.
 }
 
+// Fonction pour calculer le temps et le coût effectifs d'une arête pour une période
+// Les valeurs sont toujours dérivées des attributs nominaux : aucun cumul d'un appel à l'autre.
+void compute_effective_attributes(const EdgeAttr* attr, TimePeriod period, float* time, float* cost) {
+    bool peak = (period == PERIOD_MORNING || period == PERIOD_AFTERNOON);
+    *time = attr->baseTime * attr->timeVariation[period];
+    *cost = attr->cost * (peak ? PEAK_COST_FACTOR : 1.0f);
+}
+
 // Fonction pour ajuster les attributs d'une arête en fonction de l'heure
 void adjust_edge_attributes(Graph* graph, int src, int dest, int hour) {
+    TimePeriod period = get_time_period(hour);
     AdjListNode* current = graph->array[src].head;
 
     // Parcourir la liste d'adjacence pour trouver l'arête correspondante
     while (current != NULL) {
         if (current->dest == dest) {
-            // Exemple : augmenter le temps et le coût pendant les heures de pointe (7h-9h et 17h-19h)
-            if ((hour >= 7 && hour <= 9) || (hour >= 17 && hour <= 19)) {
-                current->attr.baseTime *= 1.5;  // Augmenter le temps de 50%
-                current->attr.cost *= 1.2;     // Augmenter le coût de 20%
-            } else {
-                // Remettre les valeurs à leur état nominal en dehors des heures de pointe
-                current->attr.baseTime /= 1.5;
-                current->attr.cost /= 1.2;
-            }
+            compute_effective_attributes(&current->attr, period, &current->effTime, &current->effCost);
             break;
         }
         current = current->next;
@@ -170,12 +1072,13 @@ void adjust_edge_attributes(Graph* graph, int src, int dest, int hour) {
 }
 
 // Fonction pour ajuster toutes les arêtes du graphe en fonction de l'heure
+// Une seule passe sur les listes d'adjacence : O(V + E).
 void adjust_graph_attributes(Graph* graph, int hour) {
+    TimePeriod period = get_time_period(hour);
     for (int v = 0; v < graph->V; v++) {
         AdjListNode* current = graph->array[v].head;
         while (current != NULL) {
-            // Ajuster les attributs de chaque arête
-            adjust_edge_attributes(graph, v, current->dest, hour);
+            compute_effective_attributes(&current->attr, period, &current->effTime, &current->effCost);
             current = current->next;
         }
     }
@@ -188,7 +1091,7 @@ void print_graph(Graph* graph) {
         printf("Liste d’adjacence du sommet %d\n", v);
         while (pCrawl) {
             printf(" -> %d (distance: %.2f, coût: %.2f, fiabilité: %.2f)\n",
-                   pCrawl->dest, pCrawl->attr.distance, pCrawl->attr.cost, pCrawl->attr.reliability);
+                   pCrawl->dest, pCrawl->attr.distance, pCrawl->effCost, pCrawl->attr.reliability);
             pCrawl = pCrawl->next;
         }
         printf("\n");
@@ -197,25 +1100,214 @@ void print_graph(Graph* graph) {
 
 // Fonction pour libérer la mémoire du graphe
 void free_graph(Graph* graph) {
-    for (int v = 0; v < graph->V; v++) {
-        AdjListNode* current = graph->array[v].head;
-        while (current) {
-            AdjListNode* temp = current;
-            current = current->next;
-            free(temp);
-        }
+    // Les nœuds d’adjacence appartiennent aux blocs : libérer les blocs suffit
+    AdjListBlock* block = graph->blocks;
+    while (block) {
+        AdjListBlock* temp = block;
+        block = block->next;
+        free(temp);
     }
+    free_connectivity(graph->connectivity);
+    free(graph->degree);
+    free(graph->degree_histogram);
+    free(graph->nodes);
     free(graph->array);
     free(graph);
 }
 
-// Fonction pour charger un graphe à partir d'un fichier JSON
-Graph* load_graph_from_json(const char* filename) {
-    // Lire le fichier JSON
-    FILE* file = fopen(filename, "r");
-    if (file == NULL) {
-        fprintf(stderr, "Erreur : Impossible d'ouvrir le fichier JSON.\n");
-        return NULL;
+// Fonction pour lire un champ numérique d'un objet JSON (valeur par défaut si absent)
+double get_json_number(const cJSON* object, const char* key, double default_value) {
+    cJSON* item = cJSON_GetObjectItem(object, key);
+    return cJSON_IsNumber(item) ? item->valuedouble : default_value;
+}
+
+// Fonction pour convertir un objet JSON d'arête en EdgeRecord
+// Retourne false si la source ou la destination est absente ou invalide.
+bool parse_edge_record(const cJSON* edge_json, EdgeRecord* record) {
+    cJSON* source = cJSON_GetObjectItem(edge_json, "source");
+    cJSON* destination = cJSON_GetObjectItem(edge_json, "destination");
+    if (!cJSON_IsNumber(source) || !cJSON_IsNumber(destination) ||
+        source->valueint < 0 || destination->valueint < 0 ||
+        source->valueint >= GRAPH_MAX_VERTICES || destination->valueint >= GRAPH_MAX_VERTICES) {
+        return false;
+    }
+
+    record->src = source->valueint;
+    record->dest = destination->valueint;
+    record->attr.distance = get_json_number(edge_json, "distance", 0);
+    record->attr.baseTime = get_json_number(edge_json, "baseTime", 0);
+    record->attr.cost = get_json_number(edge_json, "cost", 0);
+    record->attr.roadType = (int)get_json_number(edge_json, "roadType", 0);
+    record->attr.reliability = get_json_number(edge_json, "reliability", 1);
+    record->attr.restrictions = (int)get_json_number(edge_json, "restrictions", 0);
+
+    // Variations temporelles : valeurs par défaut pour les périodes absentes
+    set_default_time_variation(&record->attr);
+    cJSON* timeVariation = cJSON_GetObjectItem(edge_json, "timeVariation");
+    if (cJSON_IsObject(timeVariation)) {
+        record->attr.timeVariation[PERIOD_MORNING] =
+            get_json_number(timeVariation, "morning", record->attr.timeVariation[PERIOD_MORNING]);
+        record->attr.timeVariation[PERIOD_AFTERNOON] =
+            get_json_number(timeVariation, "afternoon", record->attr.timeVariation[PERIOD_AFTERNOON]);
+        record->attr.timeVariation[PERIOD_NIGHT] =
+            get_json_number(timeVariation, "night", record->attr.timeVariation[PERIOD_NIGHT]);
+    }
+    return true;
+}
+
+// Fonction pour construire la représentation CSR d'un graphe
+// Les arcs de chaque sommet gardent l'ordre de sa liste d'adjacence. Le CSR est un instantané :
+// il doit être reconstruit après une modification du graphe.
+CSRGraph* build_csr_graph(Graph* graph) {
+    CSRGraph* csr = (CSRGraph*)calloc(1, sizeof(CSRGraph));
+    int V = graph->V;
+    csr->V = V;
+
+    // Compter les arcs de chaque sommet
+    csr->offsets = (int*)malloc((V + 1) * sizeof(int));
+    csr->offsets[0] = 0;
+    for (int v = 0; v < V; v++) {
+        int degree = 0;
+        for (AdjListNode* current = graph->array[v].head; current != NULL; current = current->next) {
+            degree++;
+        }
+        csr->offsets[v + 1] = csr->offsets[v] + degree;
+    }
+    int A = csr->offsets[V];
+    csr->A = A;
+
+    csr->targets = (int*)malloc(A * sizeof(int));
+    csr->edge_ids = (int*)malloc(A * sizeof(int));
+    csr->distance = (float*)malloc(A * sizeof(float));
+    csr->baseTime = (float*)malloc(A * sizeof(float));
+    csr->cost = (float*)malloc(A * sizeof(float));
+    csr->reliability = (float*)malloc(A * sizeof(float));
+    csr->roadType = (int*)malloc(A * sizeof(int));
+    csr->restrictions = (int*)malloc(A * sizeof(int));
+    csr->nodeCapacity = (int*)malloc((V + 1) * sizeof(int));
+    for (int v = 0; v < V; v++) {
+        csr->nodeCapacity[v] = graph->nodes[v].capacity;
+    }
+    for (int p = 0; p < NUM_PERIODS; p++) {
+        csr->timeVariation[p] = (float*)malloc(A * sizeof(float));
+    }
+
+    // Renuméroter les arêtes de façon dense (les suppressions laissent des trous)
+    int* remap = (int*)malloc((graph->next_edge_id + 1) * sizeof(int));
+    for (int i = 0; i < graph->next_edge_id; i++) {
+        remap[i] = -1;
+    }
+    int E = 0;
+
+    for (int v = 0; v < V; v++) {
+        int a = csr->offsets[v];
+        for (AdjListNode* current = graph->array[v].head; current != NULL; current = current->next, a++) {
+            if (remap[current->edge_id] < 0) {
+                remap[current->edge_id] = E++;
+            }
+            csr->targets[a] = current->dest;
+            csr->edge_ids[a] = remap[current->edge_id];
+            csr->distance[a] = current->attr.distance;
+            csr->baseTime[a] = current->attr.baseTime;
+            csr->cost[a] = current->attr.cost;
+            csr->reliability[a] = current->attr.reliability;
+            csr->roadType[a] = current->attr.roadType;
+            csr->restrictions[a] = current->attr.restrictions;
+            for (int p = 0; p < NUM_PERIODS; p++) {
+                csr->timeVariation[p][a] = current->attr.timeVariation[p];
+            }
+        }
+    }
+    csr->E = E;
+
+    free(remap);
+    return csr;
+}
+
+// Fonction pour libérer la mémoire d'un graphe CSR
+void free_csr_graph(CSRGraph* csr) {
+    free(csr->offsets);
+    free(csr->targets);
+    free(csr->edge_ids);
+    free(csr->distance);
+    free(csr->baseTime);
+    free(csr->cost);
+    free(csr->reliability);
+    free(csr->roadType);
+    free(csr->restrictions);
+    free(csr->nodeCapacity);
+    for (int p = 0; p < NUM_PERIODS; p++) {
+        free(csr->timeVariation[p]);
+        free(csr->periodWeights[p]);
+    }
+    free(csr->effTime);
+    free(csr->effCost);
+    free(csr);
+}
+
+// Fonction pour recalculer le temps et le coût effectifs de tous les arcs d'un CSR
+// Passe linéaire sur les colonnes nominales, résultat écrit dans les colonnes effTime / effCost.
+// Peut être appelée à chaque mise à jour du trafic sans dérive des valeurs.
+void update_effective_attributes(CSRGraph* csr, int hour) {
+    TimePeriod period = get_time_period(hour);
+    float costFactor = (period == PERIOD_MORNING || period == PERIOD_AFTERNOON) ? PEAK_COST_FACTOR : 1.0f;
+
+    if (csr->effTime == NULL) {
+        csr->effTime = (float*)malloc(csr->A * sizeof(float));
+        csr->effCost = (float*)malloc(csr->A * sizeof(float));
+    }
+
+    const float* factor = csr->timeVariation[period];
+    for (int a = 0; a < csr->A; a++) {
+        csr->effTime[a] = csr->baseTime[a] * factor[a];
+        csr->effCost[a] = csr->cost[a] * costFactor;
+    }
+}
+
+// Fonction pour obtenir le masque des restrictions qui interdisent une arête à une classe de véhicule
+int vehicle_restriction_mask(VehicleClass vehicle) {
+    switch (vehicle) {
+        case VEHICLE_LIGHT_TRUCK:
+            return RESTRICTION_LOW_CLEARANCE;
+        case VEHICLE_HEAVY_TRUCK:
+            return RESTRICTION_NO_HEAVY | RESTRICTION_LOW_CLEARANCE;
+        case VEHICLE_TANKER:
+            return RESTRICTION_NO_HEAVY | RESTRICTION_LOW_CLEARANCE | RESTRICTION_NO_HAZMAT;
+        default:
+            return 0;
+    }
+}
+
+// Fonction pour construire le filtre d'arcs d'un masque de restrictions (1 bit par arc)
+// Un arc est autorisé si (restrictions & forbiddenMask) == 0. Le filtre occupe A / 8 octets.
+uint64_t* build_restriction_filter(const CSRGraph* csr, int forbiddenMask) {
+    int words = (csr->A + 63) / 64;
+    uint64_t* filter = (uint64_t*)calloc(words > 0 ? words : 1, sizeof(uint64_t));
+    for (int a = 0; a < csr->A; a++) {
+        if ((csr->restrictions[a] & forbiddenMask) == 0) {
+            filter[a >> 6] |= 1ULL << (a & 63);
+        }
+    }
+    return filter;
+}
+
+// Fonction pour obtenir une vue filtrée d'un graphe CSR
+// La vue partage toutes les colonnes du CSR d'origine (aucune copie) : elle ne doit pas être
+// libérée avec free_csr_graph, et reste valide tant que le CSR et le filtre existent.
+// Toutes les fonctions de parcours CSR ignorent les arcs exclus par le filtre.
+CSRGraph filtered_csr_view(const CSRGraph* csr, const uint64_t* arcFilter) {
+    CSRGraph view = *csr;
+    view.arcFilter = arcFilter;
+    return view;
+}
+
+// Fonction pour charger un graphe à partir d'un fichier JSON
+Graph* load_graph_from_json(const char* filename) {
+    // Lire le fichier JSON
+    FILE* file = fopen(filename, "r");
+    if (file == NULL) {
+        fprintf(stderr, "Erreur : Impossible d'ouvrir le fichier JSON.\n");
+        return NULL;
     }
 
     fseek(file, 0, SEEK_END);
@@ -250,17 +1342,33 @@ Graph* load_graph_from_json(const char* filename) {
     // Parcourir les nœuds
     cJSON* node_json;
     cJSON_ArrayForEach(node_json, nodes_json) {
-        int id = cJSON_GetObjectItem(node_json, "id")->valueint;
-        const char* name = cJSON_GetObjectItem(node_json, "name")->valuestring;
-        const char* type = cJSON_GetObjectItem(node_json, "type")->valuestring;
+        int id = (int)get_json_number(node_json, "id", -1);
+        const char* name = cJSON_GetStringValue(cJSON_GetObjectItem(node_json, "name"));
+        const char* type = cJSON_GetStringValue(cJSON_GetObjectItem(node_json, "type"));
         cJSON* coordinates = cJSON_GetObjectItem(node_json, "coordinates");
-        int capacity = cJSON_GetObjectItem(node_json, "capacity")->valueint;
+        int capacity = (int)get_json_number(node_json, "capacity", 0);
 
-        // Ajouter le nœud au graphe (vous pouvez adapter cette partie selon votre structure)
-        printf("Nœud %d : %s (%s), capacité : %d, coordonnées : [%f, %f]\n",
-               id, name, type, capacity,
-               cJSON_GetArrayItem(coordinates, 0)->valuedouble,
-               cJSON_GetArrayItem(coordinates, 1)->valuedouble);
+        // Ajouter le nœud au graphe
+        if (id >= 0 && id < GRAPH_MAX_VERTICES && ensure_graph_vertices(graph, id + 1)) {
+            Node* node = &graph->nodes[id];
+            if (name != NULL) {
+                strncpy(node->name, name, sizeof(node->name) - 1);
+            }
+            if (type != NULL) {
+                strncpy(node->type, type, sizeof(node->type) - 1);
+            }
+            if (cJSON_GetArraySize(coordinates) == 2) {
+                node->coordinates[0] = (float)cJSON_GetArrayItem(coordinates, 0)->valuedouble;
+                node->coordinates[1] = (float)cJSON_GetArrayItem(coordinates, 1)->valuedouble;
+            }
+            node->capacity = capacity;
+        }
+        if (name != NULL && type != NULL && cJSON_GetArraySize(coordinates) == 2) {
+            printf("Nœud %d : %s (%s), capacité : %d, coordonnées : [%f, %f]\n",
+                   id, name, type, capacity,
+                   cJSON_GetArrayItem(coordinates, 0)->valuedouble,
+                   cJSON_GetArrayItem(coordinates, 1)->valuedouble);
+        }
     }
 
     // Récupérer les arêtes
@@ -268,41 +1376,383 @@ Graph* load_graph_from_json(const char* filename) {
     if (!cJSON_IsArray(edges_json)) {
         fprintf(stderr, "Erreur : Le fichier JSON ne contient pas un tableau 'edges'.\n");
         cJSON_Delete(root);
+        free_graph(graph);
         return NULL;
     }
 
     // Parcourir les arêtes
     cJSON* edge_json;
     cJSON_ArrayForEach(edge_json, edges_json) {
-        int source = cJSON_GetObjectItem(edge_json, "source")->valueint;
-        int destination = cJSON_GetObjectItem(edge_json, "destination")->valueint;
-        EdgeAttr attr;
-        attr.distance = cJSON_GetObjectItem(edge_json, "distance")->valuedouble;
-        attr.baseTime = cJSON_GetObjectItem(edge_json, "baseTime")->valuedouble;
-        attr.cost = cJSON_GetObjectItem(edge_json, "cost")->valuedouble;
-        attr.roadType = cJSON_GetObjectItem(edge_json, "roadType")->valueint;
-        attr.reliability = cJSON_GetObjectItem(edge_json, "reliability")->valuedouble;
-        attr.restrictions = cJSON_GetObjectItem(edge_json, "restrictions")->valueint;
+        EdgeRecord record;
+        if (!parse_edge_record(edge_json, &record)) {
+            fprintf(stderr, "Erreur : Arête sans source ou destination valide, ignorée.\n");
+            continue;
+        }
 
         // Gestion des variations temporelles
-        cJSON* timeVariation = cJSON_GetObjectItem(edge_json, "timeVariation");
-        if (timeVariation) {
-            double morning = cJSON_GetObjectItem(timeVariation, "morning")->valuedouble;
-            double afternoon = cJSON_GetObjectItem(timeVariation, "afternoon")->valuedouble;
-            double night = cJSON_GetObjectItem(timeVariation, "night")->valuedouble;
-
+        if (cJSON_GetObjectItem(edge_json, "timeVariation")) {
             printf("Arête de %d à %d : distance = %.2f, coût = %.2f, variations temporelles (matin = %.2f, après-midi = %.2f, nuit = %.2f)\n",
-                   source, destination, attr.distance, attr.cost, morning, afternoon, night);
+                   record.src, record.dest, record.attr.distance, record.attr.cost,
+                   record.attr.timeVariation[PERIOD_MORNING],
+                   record.attr.timeVariation[PERIOD_AFTERNOON],
+                   record.attr.timeVariation[PERIOD_NIGHT]);
         }
 
         // Ajouter l'arête au graphe
-        add_edge(graph, source, destination, attr);
+        if (!ensure_graph_vertices(graph, (record.src > record.dest ? record.src : record.dest) + 1)) {
+            continue;
+        }
+        if (!add_edge(graph, record.src, record.dest, record.attr)) {
+            cJSON_Delete(root);
+            free_graph(graph);
+            return NULL;
+        }
     }
 
     cJSON_Delete(root);
     return graph;
 }
 
+#define NDJSON_LINE_MAX 4096   // Taille maximale d'un enregistrement NDJSON (une ligne, sans le saut de ligne)
+#define NDJSON_BATCH_SIZE 1024 // Nombre d'arêtes accumulées avant insertion en masse
+
+// Fonction pour ingérer un flux NDJSON (un objet arête par ligne) dans un graphe existant
+// Le flux est lu ligne par ligne avec un tampon borné : la mémoire utilisée pour la lecture
+// ne dépend pas de la taille de l'entrée, et l'ingestion progresse au fur et à mesure que
+// les lignes arrivent (fichier en cours d'écriture, tube, stdin).
+// Retourne le nombre d'arêtes ajoutées, ou -1 en cas d'erreur de lecture.
+long ingest_ndjson_edges(Graph* graph, FILE* stream) {
+    char line[NDJSON_LINE_MAX + 1];
+    EdgeRecord* batch = (EdgeRecord*)malloc(NDJSON_BATCH_SIZE * sizeof(EdgeRecord));
+    int batchCount = 0;
+    long added = 0;
+    long lineNumber = 0;
+
+    while (fgets(line, sizeof(line), stream) != NULL) {
+        lineNumber++;
+        size_t length = strlen(line);
+
+        // Tampon plein sans saut de ligne : la ligne est complète si le flux continue par un saut
+        // de ligne (ou se termine) ; sinon elle est trop longue et ignorée jusqu'au saut de ligne
+        if (length == NDJSON_LINE_MAX && line[length - 1] != '\n') {
+            int c = fgetc(stream);
+            if (c == '\r') {
+                c = fgetc(stream);
+            }
+            if (c != '\n' && c != EOF) {
+                fprintf(stderr, "Erreur : Ligne NDJSON %ld trop longue, ignorée.\n", lineNumber);
+                while ((c = fgetc(stream)) != EOF && c != '\n') {
+                }
+                continue;
+            }
+        }
+
+        // Ignorer les lignes vides
+        while (length > 0 && (line[length - 1] == '\n' || line[length - 1] == '\r' ||
+                              line[length - 1] == ' ' || line[length - 1] == '\t')) {
+            length--;
+        }
+        if (length == 0) {
+            continue;
+        }
+
+        cJSON* edge_json = cJSON_ParseWithLength(line, length);
+        EdgeRecord record;
+        if (edge_json == NULL || !parse_edge_record(edge_json, &record)) {
+            fprintf(stderr, "Erreur : Ligne NDJSON %ld invalide, ignorée.\n", lineNumber);
+            cJSON_Delete(edge_json);
+            continue;
+        }
+        cJSON_Delete(edge_json);
+
+        batch[batchCount++] = record;
+        if (batchCount == NDJSON_BATCH_SIZE) {
+            if (!add_edges_bulk(graph, batch, batchCount)) {
+                free(batch);
+                return -1;
+            }
+            added += batchCount;
+            batchCount = 0;
+        }
+    }
+
+    if (batchCount > 0) {
+        if (!add_edges_bulk(graph, batch, batchCount)) {
+            free(batch);
+            return -1;
+        }
+        added += batchCount;
+    }
+    free(batch);
+
+    if (ferror(stream)) {
+        fprintf(stderr, "Erreur : Lecture du flux NDJSON interrompue.\n");
+        return -1;
+    }
+    return added;
+}
+
+// Fonction pour charger un graphe à partir d'un fichier NDJSON d'arêtes
+// Le nombre de sommets est déduit du plus grand identifiant rencontré.
+Graph* load_graph_from_ndjson(const char* filename) {
+    FILE* file = fopen(filename, "r");
+    if (file == NULL) {
+        fprintf(stderr, "Erreur : Impossible d'ouvrir le fichier NDJSON.\n");
+        return NULL;
+    }
+
+    Graph* graph = create_graph(0);
+    long added = ingest_ndjson_edges(graph, file);
+    fclose(file);
+
+    if (added < 0) {
+        free_graph(graph);
+        return NULL;
+    }
+    return graph;
+}
+
+#define CSV_CHUNK_SIZE (1 << 20) // Taille des blocs lus dans un fichier CSV (1 Mo)
+#define CSV_FIELD_COUNT 8         // source,destination,distance,baseTime,cost,roadType,reliability,restrictions
+#define CSV_EXPONENT_LIMIT 400    // Exposant décimal saturé à ±400 (au-delà de la plage d'un double)
+
+// Fonction pour repérer les délimiteurs (',' et '\n') d'un bloc CSV
+// Écrit la position de chaque délimiteur dans positions et retourne leur nombre.
+// Avec SSE2, 16 octets sont comparés à la fois et les positions sont extraites du masque.
+int scan_csv_delimiters(const char* data, int length, int* positions) {
+    int count = 0;
+    int i = 0;
+
+#ifdef __SSE2__
+    const __m128i comma = _mm_set1_epi8(',');
+    const __m128i newline = _mm_set1_epi8('\n');
+    for (; i + 16 <= length; i += 16) {
+        __m128i chunk = _mm_loadu_si128((const __m128i*)(data + i));
+        __m128i hits = _mm_or_si128(_mm_cmpeq_epi8(chunk, comma), _mm_cmpeq_epi8(chunk, newline));
+        unsigned mask = (unsigned)_mm_movemask_epi8(hits);
+        while (mask != 0) {
+            positions[count++] = i + __builtin_ctz(mask);
+            mask &= mask - 1; // Effacer le bit le plus bas
+        }
+    }
+#endif
+
+    for (; i < length; i++) {
+        if (data[i] == ',' || data[i] == '\n') {
+            positions[count++] = i;
+        }
+    }
+    return count;
+}
+
+// Fonction pour lire un entier dans un champ CSV [p, end)
+bool parse_csv_int(const char* p, const char* end, int* value) {
+    while (p < end && (*p == ' ' || *p == '\t')) p++;
+    while (end > p && (end[-1] == ' ' || end[-1] == '\t' || end[-1] == '\r')) end--;
+
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = (*p == '-');
+        p++;
+    }
+    if (p == end) {
+        return false;
+    }
+
+    int result = 0;
+    for (; p < end; p++) {
+        unsigned digit = (unsigned)(*p - '0');
+        // Vérifier le débordement avant d'ajouter le chiffre (y compris le dernier)
+        if (digit > 9 || result > (INT_MAX - (int)digit) / 10) {
+            return false;
+        }
+        result = result * 10 + (int)digit;
+    }
+    *value = negative ? -result : result;
+    return true;
+}
+
+// Fonction pour lire un réel dans un champ CSV [p, end) (notation décimale ou scientifique)
+// Retourne false si le champ est mal formé ou si sa valeur dépasse la plage d'un float.
+bool parse_csv_float(const char* p, const char* end, float* value) {
+    static const double powers_of_ten[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10,
+        1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+
+    while (p < end && (*p == ' ' || *p == '\t')) p++;
+    while (end > p && (end[-1] == ' ' || end[-1] == '\t' || end[-1] == '\r')) end--;
+
+    bool negative = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+        negative = (*p == '-');
+        p++;
+    }
+
+    // Accumuler tous les chiffres significatifs dans un entier, puis appliquer l'exposant
+    uint64_t mantissa = 0;
+    int exponent = 0;
+    int digits = 0;
+    for (; p < end && (unsigned)(*p - '0') <= 9; p++, digits++) {
+        if (mantissa < 100000000000000000ULL) {
+            mantissa = mantissa * 10 + (unsigned)(*p - '0');
+        } else {
+            exponent++;
+        }
+    }
+    if (p < end && *p == '.') {
+        for (p++; p < end && (unsigned)(*p - '0') <= 9; p++, digits++) {
+            if (mantissa < 100000000000000000ULL) {
+                mantissa = mantissa * 10 + (unsigned)(*p - '0');
+                exponent--;
+            }
+        }
+    }
+    if (digits == 0) {
+        return false;
+    }
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        int e = 0;
+        if (!parse_csv_int(p + 1, end, &e)) {
+            return false;
+        }
+        // Saturer avant l'addition : pas de débordement, et au plus quelques tours de boucle
+        if (e > CSV_EXPONENT_LIMIT) e = CSV_EXPONENT_LIMIT;
+        if (e < -CSV_EXPONENT_LIMIT) e = -CSV_EXPONENT_LIMIT;
+        exponent += e;
+        p = end;
+    }
+    if (p != end) {
+        return false;
+    }
+    if (exponent > CSV_EXPONENT_LIMIT) exponent = CSV_EXPONENT_LIMIT;
+    if (exponent < -CSV_EXPONENT_LIMIT) exponent = -CSV_EXPONENT_LIMIT;
+
+    double result = (double)mantissa;
+    while (exponent > 22) { result *= 1e22; exponent -= 22; }
+    while (exponent < -22) { result /= 1e22; exponent += 22; }
+    result = (exponent >= 0) ? result * powers_of_ten[exponent] : result / powers_of_ten[-exponent];
+    if (!(result <= FLT_MAX)) {
+        return false; // valeur hors de la plage d'un float (les valeurs trop petites deviennent 0)
+    }
+
+    *value = (float)(negative ? -result : result);
+    return true;
+}
+
+// Fonction pour convertir les 8 champs d'une ligne CSV en EdgeRecord
+// fields[i] pointe sur le début du champ i, ends[i] sur le délimiteur qui le termine.
+bool parse_csv_edge(const char** fields, const char** ends, EdgeRecord* record) {
+    set_default_time_variation(&record->attr);
+    return parse_csv_int(fields[0], ends[0], &record->src) &&
+           record->src >= 0 && record->src < GRAPH_MAX_VERTICES &&
+           parse_csv_int(fields[1], ends[1], &record->dest) &&
+           record->dest >= 0 && record->dest < GRAPH_MAX_VERTICES &&
+           parse_csv_float(fields[2], ends[2], &record->attr.distance) &&
+           parse_csv_float(fields[3], ends[3], &record->attr.baseTime) &&
+           parse_csv_float(fields[4], ends[4], &record->attr.cost) &&
+           parse_csv_int(fields[5], ends[5], &record->attr.roadType) &&
+           parse_csv_float(fields[6], ends[6], &record->attr.reliability) &&
+           parse_csv_int(fields[7], ends[7], &record->attr.restrictions);
+}
+
+// Fonction pour charger un graphe à partir d'une liste d'arêtes CSV
+// Format : source,destination,distance,baseTime,cost,roadType,reliability,restrictions
+// Une ligne d'en-tête éventuelle est ignorée. Les champs entre guillemets ne sont pas supportés.
+// Le fichier est lu par blocs ; les délimiteurs de chaque bloc sont repérés en une passe
+// vectorisée, puis les champs sont convertis sans strtod ni copie intermédiaire.
+Graph* load_graph_from_csv(const char* filename) {
+    FILE* file = fopen(filename, "rb");
+    if (file == NULL) {
+        fprintf(stderr, "Erreur : Impossible d'ouvrir le fichier CSV.\n");
+        return NULL;
+    }
+
+    char* buffer = (char*)malloc(CSV_CHUNK_SIZE + 1);
+    int* positions = (int*)malloc((CSV_CHUNK_SIZE + 1) * sizeof(int));
+    EdgeRecord* batch = (EdgeRecord*)malloc(CSV_CHUNK_SIZE / 16 * sizeof(EdgeRecord));
+    Graph* graph = create_graph(0);
+
+    int pending = 0;          // octets d'une ligne incomplète conservés du bloc précédent
+    long lineNumber = 0;
+    bool eof = false;
+    bool failed = false;
+
+    while (!eof) {
+        int length = pending + (int)fread(buffer + pending, 1, CSV_CHUNK_SIZE - pending, file);
+        if (length < CSV_CHUNK_SIZE) {
+            eof = true;
+            if (length > 0 && buffer[length - 1] != '\n') {
+                buffer[length++] = '\n'; // Terminer la dernière ligne
+            }
+        }
+
+        // Ne traiter que les lignes complètes du bloc
+        int complete = length;
+        while (complete > 0 && buffer[complete - 1] != '\n') {
+            complete--;
+        }
+        if (complete == 0 && !eof) {
+            fprintf(stderr, "Erreur : Ligne CSV %ld trop longue.\n", lineNumber + 1);
+            failed = true;
+            break;
+        }
+
+        int count = scan_csv_delimiters(buffer, complete, positions);
+        const char* fields[CSV_FIELD_COUNT];
+        const char* ends[CSV_FIELD_COUNT];
+        int field = 0;
+        int batchCount = 0;
+        const char* start = buffer;
+
+        for (int i = 0; i < count; i++) {
+            const char* delimiter = buffer + positions[i];
+            if (field < CSV_FIELD_COUNT) {
+                fields[field] = start;
+                ends[field] = delimiter;
+            }
+            field++;
+            start = delimiter + 1;
+
+            if (*delimiter != '\n') {
+                continue;
+            }
+
+            // Fin de ligne : convertir l'enregistrement complet
+            lineNumber++;
+            bool blank = (field == 1 && ends[0] - fields[0] <= 1 && (ends[0] == fields[0] || fields[0][0] == '\r'));
+            if (!blank) {
+                if (field == CSV_FIELD_COUNT && parse_csv_edge(fields, ends, &batch[batchCount])) {
+                    batchCount++;
+                } else if (lineNumber > 1) {
+                    fprintf(stderr, "Erreur : Ligne CSV %ld invalide, ignorée.\n", lineNumber);
+                }
+                // Une première ligne invalide est considérée comme un en-tête
+            }
+            field = 0;
+        }
+
+        if (!add_edges_bulk(graph, batch, batchCount)) {
+            failed = true;
+            break;
+        }
+
+        // Conserver la ligne incomplète pour le bloc suivant
+        pending = length - complete;
+        memmove(buffer, buffer + complete, pending);
+    }
+
+    fclose(file);
+    free(buffer);
+    free(positions);
+    free(batch);
+    if (failed) {
+        free_graph(graph);
+        return NULL;
+    }
+    return graph;
+}
+
 // Fonction pour sauvegarder un graphe dans un fichier JSON
 void save_graph_to_json(Graph* graph, const char* filename) {
     // Créer l'objet JSON racine
@@ -314,12 +1764,17 @@ void save_graph_to_json(Graph* graph, const char* filename) {
         cJSON* node_json = cJSON_CreateObject();
         cJSON_AddNumberToObject(node_json, "id", v);
 
-        // Ajouter d'autres informations sur le nœud si nécessaire
-        // Exemple : nom, type, coordonnées, capacité
-        // cJSON_AddStringToObject(node_json, "name", "NodeName");
-        // cJSON_AddStringToObject(node_json, "type", "NodeType");
-        // cJSON_AddItemToObject(node_json, "coordinates", cJSON_CreateDoubleArray(coordinates, 2));
-        // cJSON_AddNumberToObject(node_json, "capacity", capacity);
+        // Ajouter les informations du nœud : nom, type, coordonnées, capacité
+        const Node* node = &graph->nodes[v];
+        double coordinates[2] = { node->coordinates[0], node->coordinates[1] };
+        if (node->name[0] != '\0') {
+            cJSON_AddStringToObject(node_json, "name", node->name);
+        }
+        if (node->type[0] != '\0') {
+            cJSON_AddStringToObject(node_json, "type", node->type);
+        }
+        cJSON_AddItemToObject(node_json, "coordinates", cJSON_CreateDoubleArray(coordinates, 2));
+        cJSON_AddNumberToObject(node_json, "capacity", node->capacity);
 
         cJSON_AddItemToArray(nodes_json, node_json);
     }
@@ -342,11 +1797,11 @@ void save_graph_to_json(Graph* graph, const char* filename) {
                 cJSON_AddNumberToObject(edge_json, "reliability", current->attr.reliability);
                 cJSON_AddNumberToObject(edge_json, "restrictions", current->attr.restrictions);
 
-                // Ajouter des variations temporelles si elles existent
+                // Ajouter les variations temporelles de l'arête
                 cJSON* timeVariation = cJSON_CreateObject();
-                cJSON_AddNumberToObject(timeVariation, "morning", 1.2);  // Exemple de valeur
-                cJSON_AddNumberToObject(timeVariation, "afternoon", 1.5);
-                cJSON_AddNumberToObject(timeVariation, "night", 0.9);
+                cJSON_AddNumberToObject(timeVariation, "morning", current->attr.timeVariation[PERIOD_MORNING]);
+                cJSON_AddNumberToObject(timeVariation, "afternoon", current->attr.timeVariation[PERIOD_AFTERNOON]);
+                cJSON_AddNumberToObject(timeVariation, "night", current->attr.timeVariation[PERIOD_NIGHT]);
                 cJSON_AddItemToObject(edge_json, "timeVariation", timeVariation);
 
                 cJSON_AddItemToArray(edges_json, edge_json);
@@ -377,448 +1832,2511 @@ void save_graph_to_json(Graph* graph, const char* filename) {
     printf("Graphe sauvegardé dans le fichier '%s'.\n", filename);
 }
 
+// Pile explicite réutilisable pour les parcours en profondeur
+// Chaque entrée mémorise un sommet et le prochain voisin à examiner : la profondeur du
+// parcours n'est plus limitée par la pile d'appels du thread.
+typedef struct DfsStack {
+    int capacity;
+    int top;                      // nombre d'entrées dans la pile
+    int* vertex;                  // sommet de chaque entrée
+    AdjListNode** next;           // prochain voisin à examiner pour chaque entrée
+} DfsStack;
+
+// Fonction pour créer une pile de capacité initiale donnée
+DfsStack* create_dfs_stack(int capacity) {
+    DfsStack* stack = (DfsStack*)malloc(sizeof(DfsStack));
+    stack->capacity = (capacity > 0) ? capacity : 1;
+    stack->top = 0;
+    stack->vertex = (int*)malloc(stack->capacity * sizeof(int));
+    stack->next = (AdjListNode**)malloc(stack->capacity * sizeof(AdjListNode*));
+    return stack;
+}
+
+// Fonction pour libérer une pile
+void free_dfs_stack(DfsStack* stack) {
+    free(stack->vertex);
+    free(stack->next);
+    free(stack);
+}
+
+// Fonction pour empiler un sommet (sa liste d'adjacence sera parcourue depuis le début)
+void dfs_stack_push(DfsStack* stack, Graph* graph, int v) {
+    if (stack->top == stack->capacity) {
+        stack->capacity *= 2;
+        stack->vertex = (int*)realloc(stack->vertex, stack->capacity * sizeof(int));
+        stack->next = (AdjListNode**)realloc(stack->next, stack->capacity * sizeof(AdjListNode*));
+    }
+    stack->vertex[stack->top] = v;
+    stack->next[stack->top] = graph->array[v].head;
+    stack->top++;
+}
+
 // Fonction auxiliaire pour détecter les cycles
-bool detect_cycle_util(Graph* graph, int v, bool* visited, int parent) {
+// Parcours itératif depuis v ; le parent d'un sommet est l'entrée située sous lui dans la pile.
+// Les arcs portant une restriction de forbiddenMask sont ignorés (0 : tous les arcs).
+bool detect_cycle_util(Graph* graph, int v, bool* visited, int parent, int forbiddenMask, DfsStack* stack) {
+    stack->top = 0;
     visited[v] = true;
+    dfs_stack_push(stack, graph, v);
+
+    while (stack->top > 0) {
+        int top = stack->top - 1;
+        AdjListNode* current = stack->next[top];
+        if (current == NULL) {
+            stack->top--;
+            continue;
+        }
+        stack->next[top] = current->next;
+        if (!ADJ_ARC_ALLOWED(current, forbiddenMask)) {
+            continue;
+        }
 
-    AdjListNode* current = graph->array[v].head;
-    while (current != NULL) {
         int adj = current->dest;
+        int uParent = (top > 0) ? stack->vertex[top - 1] : parent;
 
         // Si le sommet adjacent n'a pas été visité, continuer la DFS
         if (!visited[adj]) {
-            if (detect_cycle_util(graph, adj, visited, v)) {
-                return true;
-            }
+            visited[adj] = true;
+            dfs_stack_push(stack, graph, adj);
         }
         // Si le sommet adjacent est visité et n'est pas le parent, un cycle est détecté
-        else if (adj != parent) {
+        else if (adj != uParent) {
             return true;
         }
-
-        current = current->next;
     }
 
     return false;
 }
 
 // Fonction principale pour détecter les cycles
-bool detect_cycle(Graph* graph) {
+// Seules les arêtes autorisées par forbiddenMask sont prises en compte (0 : toutes les arêtes).
+bool detect_cycle(Graph* graph, int forbiddenMask) {
     bool* visited = (bool*)calloc(graph->V, sizeof(bool));
+    DfsStack* stack = create_dfs_stack(graph->V);
+    bool found = false;
 
-    for (int v = 0; v < graph->V; v++) {
+    for (int v = 0; v < graph->V && !found; v++) {
         if (!visited[v]) {
-            if (detect_cycle_util(graph, v, visited, -1)) {
-                free(visited);
-                return true;
-            }
+            found = detect_cycle_util(graph, v, visited, -1, forbiddenMask, stack);
         }
     }
 
+    free_dfs_stack(stack);
     free(visited);
-    return false;
+    return found;
 }
 
-// Fonction auxiliaire pour effectuer une DFS
-void dfs_util(Graph* graph, int v, bool* visited) {
+// Fonction auxiliaire pour effectuer une DFS (itérative, avec une pile réutilisable)
+// Les arcs portant une restriction de forbiddenMask ne sont pas suivis (0 : tous les arcs).
+void dfs_util(Graph* graph, int v, bool* visited, int forbiddenMask, DfsStack* stack) {
+    stack->top = 0;
     visited[v] = true;
+    dfs_stack_push(stack, graph, v);
+
+    while (stack->top > 0) {
+        int top = stack->top - 1;
+        AdjListNode* current = stack->next[top];
+        if (current == NULL) {
+            stack->top--;
+            continue;
+        }
+        stack->next[top] = current->next;
+        if (!ADJ_ARC_ALLOWED(current, forbiddenMask)) {
+            continue;
+        }
 
-    AdjListNode* current = graph->array[v].head;
-    while (current != NULL) {
         int adj = current->dest;
         if (!visited[adj]) {
-            dfs_util(graph, adj, visited);
+            visited[adj] = true;
+            dfs_stack_push(stack, graph, adj);
         }
-        current = current->next;
     }
 }
 
 // Fonction principale pour compter les composantes connexes
-int count_connected_components(Graph* graph) {
+// Les composantes sont celles du réseau accessible avec forbiddenMask, par exemple
+// vehicle_restriction_mask(VEHICLE_HEAVY_TRUCK) ; 0 compte les composantes du graphe complet.
+int count_connected_components(Graph* graph, int forbiddenMask) {
     bool* visited = (bool*)calloc(graph->V, sizeof(bool));
+    DfsStack* stack = create_dfs_stack(graph->V);
     int count = 0;
 
     for (int v = 0; v < graph->V; v++) {
         if (!visited[v]) {
             count++;
-            dfs_util(graph, v, visited);
+            dfs_util(graph, v, visited, forbiddenMask, stack);
         }
     }
 
+    free_dfs_stack(stack);
     free(visited);
     return count;
 }
 
-// Fonction auxiliaire pour détecter les points d'articulation
-void articulation_points_util(Graph* graph, int u, bool* visited, int* disc, int* low, int* parent, bool* ap, int* time) {
-    int children = 0;
-    visited[u] = true;
+// Structure union-find (forêt d'ensembles disjoints)
+typedef struct UnionFind {
+    int n;                        // nombre d'éléments
+    int components;               // nombre d'ensembles distincts
+    int* parent;                  // parent de chaque élément (racine : lui-même)
+    unsigned char* rank;          // borne supérieure de la hauteur de chaque racine
+} UnionFind;
+
+// Fonction pour créer une structure union-find de n singletons
+UnionFind* create_union_find(int n) {
+    UnionFind* uf = (UnionFind*)malloc(sizeof(UnionFind));
+    uf->n = n;
+    uf->components = n;
+    uf->parent = (int*)malloc((n > 0 ? n : 1) * sizeof(int));
+    uf->rank = (unsigned char*)calloc(n > 0 ? n : 1, sizeof(unsigned char));
+    for (int i = 0; i < n; i++) {
+        uf->parent[i] = i;
+    }
+    return uf;
+}
 
-    disc[u] = low[u] = ++(*time);
+// Fonction pour libérer une structure union-find
+void free_union_find(UnionFind* uf) {
+    free(uf->parent);
+    free(uf->rank);
+    free(uf);
+}
 
-    AdjListNode* current = graph->array[u].head;
-    while (current != NULL) {
-        int v = current->dest;
+// Fonction pour trouver le représentant d'un élément (compression de chemin par division)
+int uf_find(UnionFind* uf, int x) {
+    while (uf->parent[x] != x) {
+        uf->parent[x] = uf->parent[uf->parent[x]];
+        x = uf->parent[x];
+    }
+    return x;
+}
 
-        if (!visited[v]) {
-            children++;
-            parent[v] = u;
-            articulation_points_util(graph, v, visited, disc, low, parent, ap, time);
+// Fonction pour réunir les ensembles de a et b (union par rang)
+// Retourne true si les deux ensembles étaient distincts.
+bool uf_union(UnionFind* uf, int a, int b) {
+    int ra = uf_find(uf, a);
+    int rb = uf_find(uf, b);
+    if (ra == rb) {
+        return false;
+    }
+    if (uf->rank[ra] < uf->rank[rb]) {
+        int tmp = ra; ra = rb; rb = tmp;
+    }
+    uf->parent[rb] = ra;
+    if (uf->rank[ra] == uf->rank[rb]) {
+        uf->rank[ra]++;
+    }
+    uf->components--;
+    return true;
+}
 
-            // Mise à jour de la valeur low
-            low[u] = (low[u] < low[v]) ? low[u] : low[v];
+// Fonction pour renuméroter des représentants en identifiants denses
+// root[v] est le représentant de v ; component[v] reçoit un identifiant dans [0, nombre de
+// composantes), attribué dans l'ordre du plus petit sommet de chaque composante.
+// root et component peuvent désigner le même tableau. Retourne le nombre de composantes.
+int relabel_components(const int* root, int V, int* component) {
+    int* dense = (int*)malloc((V > 0 ? V : 1) * sizeof(int));
+    for (int v = 0; v < V; v++) {
+        dense[v] = -1;
+    }
+    int count = 0;
+    for (int v = 0; v < V; v++) {
+        int r = root[v];
+        if (dense[r] < 0) {
+            dense[r] = count++;
+        }
+        component[v] = dense[r];
+    }
+    free(dense);
+    return count;
+}
 
-            // Vérifier si u est un point d'articulation
-            if (parent[u] == -1 && children > 1) {
-                ap[u] = true;
+// Fonction pour étiqueter les composantes connexes d'un graphe CSR par union-find (séquentiel)
+// component[v] reçoit l'identifiant dense de la composante de v. Retourne le nombre de composantes.
+int label_components_union_find(const CSRGraph* csr, int* component) {
+    UnionFind* uf = create_union_find(csr->V);
+    for (int u = 0; u < csr->V; u++) {
+        for (int a = csr->offsets[u]; a < csr->offsets[u + 1]; a++) {
+            if (CSR_ARC_ALLOWED(csr, a)) {
+                uf_union(uf, u, csr->targets[a]);
             }
-            if (parent[u] != -1 && low[v] >= disc[u]) {
-                ap[u] = true;
-            }
-        } else if (v != parent[u]) {
-            low[u] = (low[u] < disc[v]) ? low[u] : disc[v];
         }
-
-        current = current->next;
     }
+    for (int v = 0; v < csr->V; v++) {
+        uf->parent[v] = uf_find(uf, v);
+    }
+    int count = relabel_components(uf->parent, csr->V, component);
+    free_union_find(uf);
+    return count;
 }
 
-// Fonction principale pour détecter les points d'articulation
-void find_articulation_points(Graph* graph) {
-    bool* visited = (bool*)calloc(graph->V, sizeof(bool));
-    int* disc = (int*)calloc(graph->V, sizeof(int));
-    int* low = (int*)calloc(graph->V, sizeof(int));
-    int* parent = (int*)calloc(graph->V, sizeof(int));
-    bool* ap = (bool*)calloc(graph->V, sizeof(bool));
-    int time = 0;
+#define AFFOREST_NEIGHBOR_ROUNDS 2   // arcs par sommet traités avant l'échantillonnage
+#define AFFOREST_SAMPLES 1024        // sommets échantillonnés pour trouver la grande composante
 
-    for (int i = 0; i < graph->V; i++) {
-        parent[i] = -1;
-        visited[i] = false;
-        ap[i] = false;
-    }
+// Fonction de comparaison d'entiers pour qsort
+int compare_int(const void* a, const void* b) {
+    int x = *(const int*)a;
+    int y = *(const int*)b;
+    return (x > y) - (x < y);
+}
 
-    for (int i = 0; i < graph->V; i++) {
-        if (!visited[i]) {
-            articulation_points_util(graph, i, visited, disc, low, parent, ap, &time);
+// Fonction pour relier sans verrou les arbres de u et v (la racine la plus grande pointe vers la plus petite)
+// Une racine n'est modifiée que par un compare-and-swap qui vérifie qu'elle est toujours racine.
+void afforest_link(int* comp, int u, int v) {
+    int p1 = __atomic_load_n(&comp[u], __ATOMIC_RELAXED);
+    int p2 = __atomic_load_n(&comp[v], __ATOMIC_RELAXED);
+    while (p1 != p2) {
+        int high = (p1 > p2) ? p1 : p2;
+        int low = (p1 > p2) ? p2 : p1;
+        int pHigh = __atomic_load_n(&comp[high], __ATOMIC_RELAXED);
+        if (pHigh == low) {
+            break;
         }
-    }
-
-    printf("Points d'articulation :\n");
-    for (int i = 0; i < graph->V; i++) {
-        if (ap[i]) {
-            printf("%d ", i);
+        int expected = high;
+        if (pHigh == high &&
+            __atomic_compare_exchange_n(&comp[high], &expected, low, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+            break;
         }
+        p1 = __atomic_load_n(&comp[__atomic_load_n(&comp[high], __ATOMIC_RELAXED)], __ATOMIC_RELAXED);
+        p2 = __atomic_load_n(&comp[low], __ATOMIC_RELAXED);
     }
-    printf("\n");
-
-    free(visited);
-    free(disc);
-    free(low);
-    free(parent);
-    free(ap);
 }
 
-// Fonction pour calculer le degré moyen des sommets
-float calculate_average_degree(Graph* graph) {
-    int total_degree = 0;
-
-    for (int v = 0; v < graph->V; v++) {
-        AdjListNode* current = graph->array[v].head;
-        while (current != NULL) {
-            total_degree++;
-            current = current->next;
+// Fonction pour aplatir les arbres : comp[v] pointe directement vers sa racine
+void afforest_compress(int* comp, int V) {
+    #pragma omp parallel for schedule(static, 2048)
+    for (int v = 0; v < V; v++) {
+        int p = __atomic_load_n(&comp[v], __ATOMIC_RELAXED);
+        int gp = __atomic_load_n(&comp[p], __ATOMIC_RELAXED);
+        while (p != gp) {
+            __atomic_store_n(&comp[v], gp, __ATOMIC_RELAXED);
+            p = gp;
+            gp = __atomic_load_n(&comp[p], __ATOMIC_RELAXED);
         }
     }
-
-    // Diviser par le nombre de sommets
-    return (float)total_degree / graph->V;
 }
 
-// Fonction pour calculer la densité du graphe
-float calculate_density(Graph* graph) {
-    int edge_count = 0;
+// Fonction pour étiqueter les composantes connexes d'un graphe CSR en parallèle (Afforest)
+// 1. Chaque sommet est relié à ses premiers voisins, puis les arbres sont aplatis.
+// 2. Un échantillon de sommets désigne la composante la plus fréquente (en général la composante géante).
+// 3. Seuls les sommets hors de cette composante traitent leurs arcs restants.
+// L'étape 3 suppose un filtre d'arcs symétrique (les deux arcs d'une arête autorisés ensemble),
+// ce qui est le cas des filtres de restriction. Mêmes identifiants que label_components_union_find.
+int label_components_parallel(const CSRGraph* csr, int* component) {
+    int V = csr->V;
+    if (V == 0) {
+        return 0;
+    }
+    int* comp = component;
 
-    for (int v = 0; v < graph->V; v++) {
-        AdjListNode* current = graph->array[v].head;
-        while (current != NULL) {
-            edge_count++;
-            current = current->next;
+    #pragma omp parallel for schedule(static, 2048)
+    for (int v = 0; v < V; v++) {
+        comp[v] = v;
+    }
+
+    // Étape 1 : premiers voisins de chaque sommet
+    for (int round = 0; round < AFFOREST_NEIGHBOR_ROUNDS; round++) {
+        #pragma omp parallel for schedule(dynamic, 2048)
+        for (int u = 0; u < V; u++) {
+            int a = csr->offsets[u] + round;
+            if (a < csr->offsets[u + 1] && CSR_ARC_ALLOWED(csr, a)) {
+                afforest_link(comp, u, csr->targets[a]);
+            }
         }
+        afforest_compress(comp, V);
     }
 
-    // Diviser par 2 car chaque arête est comptée deux fois dans un graphe non orienté
-    edge_count /= 2;
+    // Étape 2 : composante la plus fréquente d'un échantillon déterministe de sommets
+    int* sample = (int*)malloc(AFFOREST_SAMPLES * sizeof(int));
+    for (int i = 0; i < AFFOREST_SAMPLES; i++) {
+        sample[i] = comp[(int)(((uint64_t)i * 2654435761u) % (uint64_t)V)];
+    }
+    qsort(sample, AFFOREST_SAMPLES, sizeof(int), compare_int);
+    int largest = sample[0];
+    int bestCount = 0;
+    for (int i = 0; i < AFFOREST_SAMPLES; ) {
+        int j = i;
+        while (j < AFFOREST_SAMPLES && sample[j] == sample[i]) {
+            j++;
+        }
+        if (j - i > bestCount) {
+            bestCount = j - i;
+            largest = sample[i];
+        }
+        i = j;
+    }
+    free(sample);
 
-    int V = graph->V;
-    return (float)(2 * edge_count) / (V * (V - 1));
-}
+    // Étape 3 : arcs restants des sommets hors de la grande composante
+    #pragma omp parallel for schedule(dynamic, 2048)
+    for (int u = 0; u < V; u++) {
+        if (__atomic_load_n(&comp[u], __ATOMIC_RELAXED) == largest) {
+            continue;
+        }
+        for (int a = csr->offsets[u] + AFFOREST_NEIGHBOR_ROUNDS; a < csr->offsets[u + 1]; a++) {
+            if (CSR_ARC_ALLOWED(csr, a)) {
+                afforest_link(comp, u, csr->targets[a]);
+            }
+        }
+    }
+    afforest_compress(comp, V);
 
-// Fonction pour afficher les statistiques de connectivité
-void print_connectivity_statistics(Graph* graph) {
-    int connected_components = count_connected_components(graph);
-    float average_degree = calculate_average_degree(graph);
-    float density = calculate_density(graph);
+    // La racine de chaque arbre est son plus petit sommet : renumérotation dense sur place
+    return relabel_components(comp, V, component);
+}
 
-    printf("Statistiques sur la connectivité du graphe :\n");
-    printf("Nombre de composantes connexes : %d\n", connected_components);
-    printf("Degré moyen des sommets : %.2f\n", average_degree);
-    printf("Densité du graphe : %.4f\n", density);
+// Arête candidate du balayage des seuils de fiabilité
+typedef struct ReliabilityEdge {
+    float reliability;
+    int u;
+    int v;
+} ReliabilityEdge;
+
+// Fonction de comparaison pour qsort : fiabilité décroissante
+int compare_reliability_desc(const void* a, const void* b) {
+    float x = ((const ReliabilityEdge*)a)->reliability;
+    float y = ((const ReliabilityEdge*)b)->reliability;
+    return (x < y) - (x > y);
 }
 
-// Fonction pour appliquer l'algorithme de Floyd-Warshall
-void floyd_warshall(Graph* graph, float** dist) {
-    int V = graph->V;
+// Réunion de deux groupes de hubs lors du balayage
+typedef struct HubMergeEvent {
+    float threshold;              // seuil le plus haut auquel les deux groupes sont reliés
+    int hubA;                     // plus petit hub (indice dans hubs) de chacun des deux groupes
+    int hubB;
+    int hubGroups;                // nombre de groupes de hubs restants après la réunion
+} HubMergeEvent;
+
+// Résultat du balayage des seuils de fiabilité
+// Au seuil s, seules les arêtes de fiabilité >= s sont gardées. Au-dessus de threshold[0], chaque
+// sommet est isolé ; entre threshold[i + 1] (exclu) et threshold[i] (inclus), le réseau compte
+// components[i] composantes et hubGroups[i] groupes de hubs reliés entre eux.
+typedef struct ReliabilitySweep {
+    int levelCount;               // nombre de seuils distincts
+    float* threshold;             // fiabilités distinctes des arêtes, décroissantes
+    int* components;
+    int* hubGroups;
+    int eventCount;
+    HubMergeEvent* events;        // réunions de hubs, par seuil décroissant (au plus hubCount - 1)
+} ReliabilitySweep;
+
+// Fonction pour balayer tous les seuils de fiabilité en une passe (arcs filtrés exclus)
+// Les arêtes sont triées par fiabilité décroissante puis ajoutées à un union-find : le nombre de
+// composantes est relevé après chaque seuil distinct, et chaque réunion de deux composantes
+// contenant des hubs produit un événement. Le seuil de coupure des hubs (au-dessus duquel au
+// moins deux hubs sont séparés) est celui du dernier événement. Retourne NULL si un hub est
+// hors limites.
+ReliabilitySweep* sweep_reliability_thresholds(const CSRGraph* csr, const int* hubs, int hubCount) {
+    int V = csr->V;
+    for (int i = 0; i < hubCount; i++) {
+        if (hubs[i] < 0 || hubs[i] >= V) {
+            fprintf(stderr, "Erreur : Hub %d hors limites (%d sommets).\n", hubs[i], V);
+            return NULL;
+        }
+    }
+    ReliabilityEdge* edges = (ReliabilityEdge*)malloc((csr->A / 2 + 1) * sizeof(ReliabilityEdge));
+    int edgeCount = 0;
+    for (int u = 0; u < V; u++) {
+        for (int a = csr->offsets[u]; a < csr->offsets[u + 1]; a++) {
+            if (u < csr->targets[a] && CSR_ARC_ALLOWED(csr, a)) {
+                edges[edgeCount].reliability = csr->reliability[a];
+                edges[edgeCount].u = u;
+                edges[edgeCount].v = csr->targets[a];
+                edgeCount++;
+            }
+        }
+    }
+    qsort(edges, edgeCount, sizeof(ReliabilityEdge), compare_reliability_desc);
+
+    ReliabilitySweep* sweep = (ReliabilitySweep*)malloc(sizeof(ReliabilitySweep));
+    sweep->levelCount = 0;
+    sweep->threshold = (float*)malloc((edgeCount + 1) * sizeof(float));
+    sweep->components = (int*)malloc((edgeCount + 1) * sizeof(int));
+    sweep->hubGroups = (int*)malloc((edgeCount + 1) * sizeof(int));
+    sweep->eventCount = 0;
+    sweep->events = (HubMergeEvent*)malloc((hubCount + 1) * sizeof(HubMergeEvent));
+
+    // Plus petit hub de chaque composante (indice dans hubs, -1 : aucun), tenu à jour sur la racine
+    int* hubOf = (int*)malloc((V > 0 ? V : 1) * sizeof(int));
+    for (int v = 0; v < V; v++) {
+        hubOf[v] = -1;
+    }
+    int hubGroups = 0;
+    for (int i = 0; i < hubCount; i++) {
+        if (hubOf[hubs[i]] < 0) {
+            hubOf[hubs[i]] = i;
+            hubGroups++;
+        }
+    }
 
-    // Initialiser la matrice des distances
-    for (int i = 0; i < V; i++) {
-        for (int j = 0; j < V; j++) {
-            if (i == j) {
-                dist[i][j] = 0;
-            } else {
-                dist[i][j] = INF;
+    UnionFind* uf = create_union_find(V);
+    for (int i = 0; i < edgeCount; i++) {
+        float r = edges[i].reliability;
+        int ra = uf_find(uf, edges[i].u);
+        int rb = uf_find(uf, edges[i].v);
+        if (ra != rb) {
+            int hubA = hubOf[ra];
+            int hubB = hubOf[rb];
+            uf_union(uf, ra, rb);
+            int root = uf_find(uf, ra);
+            if (hubA >= 0 && hubB >= 0) {
+                hubGroups--;
+                HubMergeEvent* event = &sweep->events[sweep->eventCount++];
+                event->threshold = r;
+                event->hubA = (hubA < hubB) ? hubA : hubB;
+                event->hubB = (hubA < hubB) ? hubB : hubA;
+                event->hubGroups = hubGroups;
             }
+            hubOf[root] = (hubA < 0 || (hubB >= 0 && hubB < hubA)) ? hubB : hubA;
         }
 
-        AdjListNode* current = graph->array[i].head;
-        while (current != NULL) {
-            dist[i][current->dest] = current->attr.distance;
-            current = current->next;
+        // Dernière arête de ce seuil : relever l'état du réseau
+        if (i + 1 == edgeCount || edges[i + 1].reliability != r) {
+            sweep->threshold[sweep->levelCount] = r;
+            sweep->components[sweep->levelCount] = uf->components;
+            sweep->hubGroups[sweep->levelCount] = hubGroups;
+            sweep->levelCount++;
         }
     }
 
-    // Appliquer l'algorithme de Floyd-Warshall
-    for (int k = 0; k < V; k++) {
-        for (int i = 0; i < V; i++) {
-            for (int j = 0; j < V; j++) {
-                if (dist[i][k] + dist[k][j] < dist[i][j]) {
-                    dist[i][j] = dist[i][k] + dist[k][j];
-                }
-            }
+    free_union_find(uf);
+    free(hubOf);
+    free(edges);
+    return sweep;
+}
+
+// Fonction pour obtenir le nombre de composantes au seuil cutoff (recherche dichotomique)
+int sweep_components_at(const ReliabilitySweep* sweep, int V, float cutoff) {
+    // Dernier niveau dont le seuil est >= cutoff
+    int lo = 0, hi = sweep->levelCount;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (sweep->threshold[mid] >= cutoff) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
         }
     }
+    return (lo == 0) ? V : sweep->components[lo - 1];
 }
 
-// Fonction pour calculer le coût total d'un chemin donné
-float calculate_path_cost(int* path, int V, float** dist) {
-    float cost = 0;
-    for (int i = 0; i < V - 1; i++) {
-        cost += dist[path[i]][path[i + 1]];
+// Fonction pour afficher les seuils auxquels des hubs se séparent
+void print_reliability_sweep(const ReliabilitySweep* sweep, const int* hubs) {
+    printf("Balayage des seuils de fiabilité (%d seuils distincts) :\n", sweep->levelCount);
+    for (int i = sweep->eventCount - 1; i >= 0; i--) {
+        const HubMergeEvent* event = &sweep->events[i];
+        printf("Au-dessus de %.3f : hubs %d et %d séparés (%d groupes de hubs)\n", event->threshold,
+               hubs[event->hubA], hubs[event->hubB], event->hubGroups + 1);
     }
-    cost += dist[path[V - 1]][path[0]]; // Retour au point de départ
-    return cost;
 }
 
-// Fonction pour générer toutes les permutations des sommets
-void tsp_permute(int* path, int l, int r, float** dist, float* min_cost, int* best_path, int V) {
-    if (l == r) {
-        float cost = calculate_path_cost(path, V, dist);
-        if (cost < *min_cost) {
-            *min_cost = cost;
-            memcpy(best_path, path, V * sizeof(int));
-        }
+// Fonction pour libérer le résultat d'un balayage
+void free_reliability_sweep(ReliabilitySweep* sweep) {
+    if (sweep == NULL) {
         return;
     }
+    free(sweep->threshold);
+    free(sweep->components);
+    free(sweep->hubGroups);
+    free(sweep->events);
+    free(sweep);
+}
 
-    for (int i = l; i <= r; i++) {
-        // Échanger les sommets
-        int temp = path[l];
-        path[l] = path[i];
-        path[i] = temp;
+// Fonction auxiliaire pour détecter les points d'articulation
+// Version itérative : low[u] est propagé au parent quand u est dépilé.
+void articulation_points_util(Graph* graph, int root, bool* visited, int* disc, int* low, int* parent,
+                              bool* ap, int* time, int forbiddenMask, DfsStack* stack) {
+    int rootChildren = 0;
+    stack->top = 0;
+    visited[root] = true;
+    disc[root] = low[root] = ++(*time);
+    dfs_stack_push(stack, graph, root);
+
+    while (stack->top > 0) {
+        int top = stack->top - 1;
+        int u = stack->vertex[top];
+        AdjListNode* current = stack->next[top];
+
+        if (current == NULL) {
+            // Tous les voisins de u sont traités : remonter vers son parent
+            stack->top--;
+            int p = parent[u];
+            if (p != -1) {
+                // Mise à jour de la valeur low
+                low[p] = (low[p] < low[u]) ? low[p] : low[u];
+
+                // Vérifier si p est un point d'articulation
+                if (parent[p] != -1 && low[u] >= disc[p]) {
+                    ap[p] = true;
+                }
+            }
+            continue;
+        }
+        stack->next[top] = current->next;
+        if (!ADJ_ARC_ALLOWED(current, forbiddenMask)) {
+            continue;
+        }
 
-        tsp_permute(path, l + 1, r, dist, min_cost, best_path, V);
+        int v = current->dest;
+        if (!visited[v]) {
+            if (u == root) {
+                rootChildren++;
+            }
+            parent[v] = u;
+            visited[v] = true;
+            disc[v] = low[v] = ++(*time);
+            dfs_stack_push(stack, graph, v);
+        } else if (v != parent[u]) {
+            low[u] = (low[u] < disc[v]) ? low[u] : disc[v];
+        }
+    }
 
-        // Revenir à l'état précédent
-        temp = path[l];
-        path[l] = path[i];
-        path[i] = temp;
+    // La racine est un point d'articulation si elle a plusieurs enfants
+    if (rootChildren > 1) {
+        ap[root] = true;
     }
 }
 
-// Fonction principale pour résoudre le TSP
-void solve_tsp(Graph* graph) {
-    int V = graph->V;
+// Fonction principale pour détecter les points d'articulation
+// Les points sont calculés sur le réseau accessible avec forbiddenMask (0 : graphe complet).
+void find_articulation_points(Graph* graph, int forbiddenMask) {
+    bool* visited = (bool*)calloc(graph->V, sizeof(bool));
+    int* disc = (int*)calloc(graph->V, sizeof(int));
+    int* low = (int*)calloc(graph->V, sizeof(int));
+    int* parent = (int*)calloc(graph->V, sizeof(int));
+    bool* ap = (bool*)calloc(graph->V, sizeof(bool));
+    DfsStack* stack = create_dfs_stack(graph->V);
+    int time = 0;
 
-    // Calculer la matrice des distances avec Floyd-Warshall
-    float** dist = (float**)malloc(V * sizeof(float*));
-    for (int i = 0; i < V; i++) {
-        dist[i] = (float*)malloc(V * sizeof(float));
+    for (int i = 0; i < graph->V; i++) {
+        parent[i] = -1;
+        visited[i] = false;
+        ap[i] = false;
     }
-    floyd_warshall(graph, dist);
 
-    // Initialiser les variables pour le TSP
-    int* path = (int*)malloc(V * sizeof(int));
-    int* best_path = (int*)malloc(V * sizeof(int));
-    for (int i = 0; i < V; i++) {
-        path[i] = i;
+    for (int i = 0; i < graph->V; i++) {
+        if (!visited[i]) {
+            articulation_points_util(graph, i, visited, disc, low, parent, ap, &time, forbiddenMask, stack);
+        }
     }
 
-    float min_cost = INF;
-
-    // Trouver le chemin optimal
-    tsp_permute(path, 0, V - 1, dist, &min_cost, best_path, V);
-
-    // Afficher le résultat
-    printf("Chemin optimal : ");
-    for (int i = 0; i < V; i++) {
-        printf("%d -> ", best_path[i]);
+    printf("Points d'articulation :\n");
+    for (int i = 0; i < graph->V; i++) {
+        if (ap[i]) {
+            printf("%d ", i);
+        }
     }
-    printf("%d\n", best_path[0]);
-    printf("Coût minimal : %.2f\n", min_cost);
+    printf("\n");
 
-    // Libérer la mémoire
-    for (int i = 0; i < V; i++) {
-        free(dist[i]);
-    }
-    free(dist);
-    free(path);
-    free(best_path);
+    free(visited);
+    free(disc);
+    free(low);
+    free(parent);
+    free(ap);
+    free_dfs_stack(stack);
 }
 
-// Fonction pour ajuster les poids des arêtes en fonction des contraintes temporelles
-float adjust_edge_weight(EdgeAttr attr, int hour) {
-    float adjusted_weight = attr.distance; // Poids de base : distance
-
-    // Ajuster le poids en fonction des heures de pointe
-    if ((hour >= 7 && hour <= 9) || (hour >= 17 && hour <= 19)) {
-        adjusted_weight *= 1.5; // Augmenter le poids de 50% pendant les heures de pointe
-    } else if (hour >= 22 || hour <= 5) {
-        adjusted_weight *= 0.8; // Réduire le poids de 20% pendant la nuit
+// Décomposition en composantes biconnexes d'un graphe CSR (résultat et espace de travail)
+// Les tableaux sont dimensionnés pour vertexCapacity sommets et edgeCapacity arêtes : tant que
+// le graphe analysé tient dans ces capacités, compute_biconnected_components n'alloue rien.
+// Arbre blocs-sommets de coupure : les blocs sont numérotés [0, blockCount), le sommet de
+// coupure articulationPoints[i] est le nœud blockCount + i.
+typedef struct BiconnectedComponents {
+    int vertexCapacity;
+    int edgeCapacity;
+
+    // Résultats
+    bool* isArticulation;         // sommet de coupure (V)
+    int* articulationPoints;      // liste des sommets de coupure (V)
+    int articulationCount;
+    int* bridges;                 // ponts, par paires (u, v) (2 E)
+    int bridgeCount;
+    int* edgeBlock;               // bloc de chaque arête, -1 pour une boucle ou une arête filtrée (E)
+    int* blockEdges;              // arêtes regroupées par bloc (E)
+    int* blockStart;              // début des arêtes de chaque bloc dans blockEdges (E + 1)
+    int blockCount;
+    int* cutTree;                 // arêtes de l'arbre blocs-sommets de coupure, par paires (bloc, nœud) (4 E)
+    int cutTreeEdgeCount;
+
+    // Espace de travail
+    int* disc;                    // ordre de découverte (0 : non visité) (V)
+    int* low;                     // plus petit ordre atteignable (V)
+    int* cutIndex;                // indice du sommet de coupure dans articulationPoints (V)
+    int* mark;                    // dernier bloc ayant référencé le sommet (V)
+    int* stackVertex;             // pile de parcours : sommet (V)
+    int* stackArc;                // pile de parcours : prochain arc à examiner (V)
+    int* stackEdge;               // pile de parcours : arête d'arrivée (V)
+    int* edgeStack;               // arêtes du bloc en cours de construction (E)
+    int* edgeU;                   // extrémités des arêtes parcourues (E)
+    int* edgeV;
+} BiconnectedComponents;
+
+// Fonction pour (ré)allouer les tableaux d'une décomposition
+void reserve_biconnected_components(BiconnectedComponents* bcc, int V, int E) {
+    if (V > bcc->vertexCapacity) {
+        bcc->vertexCapacity = V;
+        bcc->isArticulation = (bool*)realloc(bcc->isArticulation, V * sizeof(bool));
+        bcc->articulationPoints = (int*)realloc(bcc->articulationPoints, V * sizeof(int));
+        bcc->disc = (int*)realloc(bcc->disc, V * sizeof(int));
+        bcc->low = (int*)realloc(bcc->low, V * sizeof(int));
+        bcc->cutIndex = (int*)realloc(bcc->cutIndex, V * sizeof(int));
+        bcc->mark = (int*)realloc(bcc->mark, V * sizeof(int));
+        bcc->stackVertex = (int*)realloc(bcc->stackVertex, V * sizeof(int));
+        bcc->stackArc = (int*)realloc(bcc->stackArc, V * sizeof(int));
+        bcc->stackEdge = (int*)realloc(bcc->stackEdge, V * sizeof(int));
     }
+    if (E > bcc->edgeCapacity) {
+        bcc->edgeCapacity = E;
+        bcc->bridges = (int*)realloc(bcc->bridges, 2 * E * sizeof(int));
+        bcc->edgeBlock = (int*)realloc(bcc->edgeBlock, E * sizeof(int));
+        bcc->blockEdges = (int*)realloc(bcc->blockEdges, E * sizeof(int));
+        bcc->blockStart = (int*)realloc(bcc->blockStart, (E + 1) * sizeof(int));
+        bcc->cutTree = (int*)realloc(bcc->cutTree, 4 * E * sizeof(int));
+        bcc->edgeStack = (int*)realloc(bcc->edgeStack, E * sizeof(int));
+        bcc->edgeU = (int*)realloc(bcc->edgeU, E * sizeof(int));
+        bcc->edgeV = (int*)realloc(bcc->edgeV, E * sizeof(int));
+    }
+}
 
-    // Ajouter un coût variable (par exemple, coût monétaire)
-    adjusted_weight += attr.cost / 1000.0; // Normaliser le coût pour l'ajouter au poids
-
-    return adjusted_weight;
+// Fonction pour créer une décomposition dimensionnée pour V sommets et E arêtes
+BiconnectedComponents* create_biconnected_components(int V, int E) {
+    BiconnectedComponents* bcc = (BiconnectedComponents*)calloc(1, sizeof(BiconnectedComponents));
+    reserve_biconnected_components(bcc, V > 0 ? V : 1, E > 0 ? E : 1);
+    return bcc;
 }
 
-// Fonction principale de Bellman-Ford
-bool bellman_ford(Graph* graph, int src, int hour, float* dist) {
-    int V = graph->V;
-    int E = 0; // Nombre d'arêtes (sera calculé)
+// Fonction pour libérer une décomposition
+void free_biconnected_components(BiconnectedComponents* bcc) {
+    free(bcc->isArticulation);
+    free(bcc->articulationPoints);
+    free(bcc->bridges);
+    free(bcc->edgeBlock);
+    free(bcc->blockEdges);
+    free(bcc->blockStart);
+    free(bcc->cutTree);
+    free(bcc->disc);
+    free(bcc->low);
+    free(bcc->cutIndex);
+    free(bcc->mark);
+    free(bcc->stackVertex);
+    free(bcc->stackArc);
+    free(bcc->stackEdge);
+    free(bcc->edgeStack);
+    free(bcc->edgeU);
+    free(bcc->edgeV);
+    free(bcc);
+}
 
-    // Initialiser les distances à l'infini
-    for (int i = 0; i < V; i++) {
-        dist[i] = FLT_MAX;
-    }
-    dist[src] = 0; // La distance à la source est 0
+// Fonction pour calculer sommets de coupure, ponts et blocs d'un graphe CSR (Tarjan itératif)
+// Un seul parcours en profondeur, en O(V + E) ; les arcs exclus par le filtre de la vue sont
+// ignorés. L'arête d'arrivée est identifiée par son edge_id : les arêtes parallèles ne sont
+// donc jamais des ponts.
+void compute_biconnected_components(const CSRGraph* csr, BiconnectedComponents* bcc) {
+    int V = csr->V;
+    reserve_biconnected_components(bcc, V, csr->E);
 
-    // Compter le nombre total d'arêtes
     for (int v = 0; v < V; v++) {
-        AdjListNode* current = graph->array[v].head;
-        while (current != NULL) {
-            E++;
-            current = current->next;
-        }
+        bcc->disc[v] = 0;
+        bcc->isArticulation[v] = false;
+        bcc->mark[v] = -1;
     }
+    for (int e = 0; e < csr->E; e++) {
+        bcc->edgeBlock[e] = -1;
+    }
+    bcc->articulationCount = 0;
+    bcc->bridgeCount = 0;
+    bcc->blockCount = 0;
+    bcc->blockStart[0] = 0;
+    bcc->cutTreeEdgeCount = 0;
 
-    // Relaxer les arêtes V-1 fois
-    for (int i = 1; i <= V - 1; i++) {
-        for (int v = 0; v < V; v++) {
-            AdjListNode* current = graph->array[v].head;
-            while (current != NULL) {
-                int u = v;
-                int dest = current->dest;
-                float weight = adjust_edge_weight(current->attr, hour);
+    int time = 0;
+    int edgeTop = 0;
+    int blockEdgeCount = 0;
 
-                if (dist[u] != FLT_MAX && dist[u] + weight < dist[dest]) {
-                    dist[dest] = dist[u] + weight;
+    for (int root = 0; root < V; root++) {
+        if (bcc->disc[root] != 0) {
+            continue;
+        }
+        int rootChildren = 0;
+        bcc->disc[root] = bcc->low[root] = ++time;
+        bcc->stackVertex[0] = root;
+        bcc->stackArc[0] = csr->offsets[root];
+        bcc->stackEdge[0] = -1;
+        int top = 1;
+
+        while (top > 0) {
+            int u = bcc->stackVertex[top - 1];
+            int a = bcc->stackArc[top - 1];
+
+            if (a == csr->offsets[u + 1]) {
+                // Tous les arcs de u sont traités : remonter vers son parent
+                top--;
+                if (top == 0) {
+                    break;
+                }
+                int p = bcc->stackVertex[top - 1];
+                int edge = bcc->stackEdge[top];
+                if (bcc->low[u] < bcc->low[p]) {
+                    bcc->low[p] = bcc->low[u];
                 }
+                if (bcc->low[u] >= bcc->disc[p]) {
+                    // p sépare le sous-arbre de u : les arêtes empilées depuis (p, u) forment un bloc
+                    if (p != root) {
+                        bcc->isArticulation[p] = true;
+                    }
+                    int e;
+                    do {
+                        e = bcc->edgeStack[--edgeTop];
+                        bcc->edgeBlock[e] = bcc->blockCount;
+                        bcc->blockEdges[blockEdgeCount++] = e;
+                    } while (e != edge);
+                    bcc->blockStart[++bcc->blockCount] = blockEdgeCount;
+                }
+                if (bcc->low[u] > bcc->disc[p]) {
+                    bcc->bridges[2 * bcc->bridgeCount] = p;
+                    bcc->bridges[2 * bcc->bridgeCount + 1] = u;
+                    bcc->bridgeCount++;
+                }
+                continue;
+            }
+            bcc->stackArc[top - 1] = a + 1;
+            if (!CSR_ARC_ALLOWED(csr, a)) {
+                continue;
+            }
 
-                current = current->next;
+            int v = csr->targets[a];
+            int edge = csr->edge_ids[a];
+            if (bcc->disc[v] == 0) {
+                // Arc d'arbre
+                if (u == root) {
+                    rootChildren++;
+                }
+                bcc->edgeU[edge] = u;
+                bcc->edgeV[edge] = v;
+                bcc->edgeStack[edgeTop++] = edge;
+                bcc->disc[v] = bcc->low[v] = ++time;
+                bcc->stackVertex[top] = v;
+                bcc->stackArc[top] = csr->offsets[v];
+                bcc->stackEdge[top] = edge;
+                top++;
+            } else if (edge != bcc->stackEdge[top - 1] && bcc->disc[v] < bcc->disc[u]) {
+                // Arc arrière vers un ancêtre (chaque arête arrière n'est empilée qu'une fois)
+                bcc->edgeU[edge] = u;
+                bcc->edgeV[edge] = v;
+                bcc->edgeStack[edgeTop++] = edge;
+                if (bcc->disc[v] < bcc->low[u]) {
+                    bcc->low[u] = bcc->disc[v];
+                }
             }
         }
+
+        // La racine est un sommet de coupure si elle a plusieurs enfants
+        if (rootChildren > 1) {
+            bcc->isArticulation[root] = true;
+        }
     }
 
-    // Vérifier les cycles de poids négatif
     for (int v = 0; v < V; v++) {
-        AdjListNode* current = graph->array[v].head;
-        while (current != NULL) {
-            int u = v;
-            int dest = current->dest;
-            float weight = adjust_edge_weight(current->attr, hour);
+        if (bcc->isArticulation[v]) {
+            bcc->cutIndex[v] = bcc->articulationCount;
+            bcc->articulationPoints[bcc->articulationCount++] = v;
+        }
+    }
 
-            if (dist[u] != FLT_MAX && dist[u] + weight < dist[dest]) {
-                printf("Le graphe contient un cycle de poids négatif.\n");
-                return false;
+    // Arbre blocs-sommets de coupure : relier chaque bloc à ses sommets de coupure (sans doublon)
+    for (int b = 0; b < bcc->blockCount; b++) {
+        for (int i = bcc->blockStart[b]; i < bcc->blockStart[b + 1]; i++) {
+            int e = bcc->blockEdges[i];
+            int ends[2] = { bcc->edgeU[e], bcc->edgeV[e] };
+            for (int k = 0; k < 2; k++) {
+                int w = ends[k];
+                if (bcc->isArticulation[w] && bcc->mark[w] != b) {
+                    bcc->mark[w] = b;
+                    bcc->cutTree[2 * bcc->cutTreeEdgeCount] = b;
+                    bcc->cutTree[2 * bcc->cutTreeEdgeCount + 1] = bcc->blockCount + bcc->cutIndex[w];
+                    bcc->cutTreeEdgeCount++;
+                }
             }
-
-            current = current->next;
         }
     }
-
-    return true;
 }
 
-// Fonction pour trouver le sommet le plus proche non visité
-int find_nearest_neighbor(int current, bool* visited, float** dist, int V) {
-    int nearest = -1;
-    float min_distance = FLT_MAX;
+#define BFS_ALPHA 15          // passage en ascendant quand les arcs de la frontière dépassent 1/15 des arcs restants
+#define BFS_BETA 18           // retour en descendant quand la frontière compte moins de V/18 sommets
+#define BFS_LOCAL_BUFFER 256  // sommets accumulés par thread avant insertion dans la frontière partagée
+
+// Espace de travail d'un parcours en largeur (réutilisable d'une source à l'autre)
+typedef struct BfsWorkspace {
+    int capacity;                 // nombre de sommets pris en charge
+    int* frontier;                // frontière courante (liste de sommets)
+    int* next;                    // frontière suivante (liste de sommets)
+    uint64_t* visited;            // sommets atteints (1 bit par sommet)
+    uint64_t* frontierBits;       // frontière courante (1 bit par sommet)
+    uint64_t* nextBits;           // frontière suivante (1 bit par sommet)
+} BfsWorkspace;
+
+// Fonction pour créer un espace de travail BFS pour V sommets
+BfsWorkspace* create_bfs_workspace(int V) {
+    BfsWorkspace* ws = (BfsWorkspace*)malloc(sizeof(BfsWorkspace));
+    int words = (V + 63) / 64 + 1;
+    ws->capacity = V;
+    ws->frontier = (int*)malloc((V + 1) * sizeof(int));
+    ws->next = (int*)malloc((V + 1) * sizeof(int));
+    ws->visited = (uint64_t*)malloc(words * sizeof(uint64_t));
+    ws->frontierBits = (uint64_t*)malloc(words * sizeof(uint64_t));
+    ws->nextBits = (uint64_t*)malloc(words * sizeof(uint64_t));
+    return ws;
+}
 
-    for (int i = 0; i < V; i++) {
-        if (!visited[i] && dist[current][i] < min_distance) {
-            min_distance = dist[current][i];
-            nearest = i;
-        }
+// Fonction pour agrandir un espace de travail BFS à V sommets
+// Retourne false si une allocation échoue (la capacité reste alors inchangée).
+bool reserve_bfs_workspace(BfsWorkspace* ws, int V) {
+    if (V <= ws->capacity) {
+        return true;
+    }
+    int words = (V + 63) / 64 + 1;
+    int* frontier = (int*)realloc(ws->frontier, (V + 1) * sizeof(int));
+    if (frontier != NULL) {
+        ws->frontier = frontier;
+    }
+    int* next = (int*)realloc(ws->next, (V + 1) * sizeof(int));
+    if (next != NULL) {
+        ws->next = next;
+    }
+    uint64_t* visited = (uint64_t*)realloc(ws->visited, words * sizeof(uint64_t));
+    if (visited != NULL) {
+        ws->visited = visited;
     }
+    uint64_t* frontierBits = (uint64_t*)realloc(ws->frontierBits, words * sizeof(uint64_t));
+    if (frontierBits != NULL) {
+        ws->frontierBits = frontierBits;
+    }
+    uint64_t* nextBits = (uint64_t*)realloc(ws->nextBits, words * sizeof(uint64_t));
+    if (nextBits != NULL) {
+        ws->nextBits = nextBits;
+    }
+    if (frontier == NULL || next == NULL || visited == NULL || frontierBits == NULL || nextBits == NULL) {
+        fprintf(stderr, "Erreur : Allocation de l'espace de travail BFS (%d sommets) impossible.\n", V);
+        return false;
+    }
+    ws->capacity = V;
+    return true;
+}
 
-    return nearest;
+// Fonction pour libérer un espace de travail BFS
+void free_bfs_workspace(BfsWorkspace* ws) {
+    free(ws->frontier);
+    free(ws->next);
+    free(ws->visited);
+    free(ws->frontierBits);
+    free(ws->nextBits);
+    free(ws);
 }
 
-// Approche gloutonne pour résoudre le TSP
-void greedy_tsp(Graph* graph) {
-    int V = graph->V;
+// Fonction pour ajouter un lot de sommets à une frontière partagée (une seule opération atomique)
+void bfs_flush(int* queue, int* size, const int* local, int count) {
+    int start = __atomic_fetch_add(size, count, __ATOMIC_RELAXED);
+    memcpy(queue + start, local, count * sizeof(int));
+}
 
-    // Calculer la matrice des distances avec Floyd-Warshall
-    float** dist = (float**)malloc(V * sizeof(float*));
-    for (int i = 0; i < V; i++) {
-        dist[i] = (float*)malloc(V * sizeof(float));
+// Fonction pour une étape descendante : chaque sommet de la frontière examine ses voisins
+// Un sommet est revendiqué par un « ou » atomique sur son mot du bitmap visited.
+// Retourne la somme des degrés de la nouvelle frontière.
+long bfs_top_down_step(const CSRGraph* csr, BfsWorkspace* ws, int frontierSize, int* nextSize,
+                       int* hops, int* parent, int level) {
+    long scout = 0;
+    *nextSize = 0;
+
+    #pragma omp parallel reduction(+ : scout)
+    {
+        int local[BFS_LOCAL_BUFFER];
+        int count = 0;
+
+        #pragma omp for schedule(dynamic, 64) nowait
+        for (int i = 0; i < frontierSize; i++) {
+            int u = ws->frontier[i];
+            for (int a = csr->offsets[u]; a < csr->offsets[u + 1]; a++) {
+                if (!CSR_ARC_ALLOWED(csr, a)) {
+                    continue;
+                }
+                int v = csr->targets[a];
+                uint64_t bit = 1ULL << (v & 63);
+                if (__atomic_load_n(&ws->visited[v >> 6], __ATOMIC_RELAXED) & bit) {
+                    continue;
+                }
+                if (__atomic_fetch_or(&ws->visited[v >> 6], bit, __ATOMIC_RELAXED) & bit) {
+                    continue; // revendiqué entre-temps par un autre thread
+                }
+                parent[v] = u;
+                hops[v] = level + 1;
+                scout += csr->offsets[v + 1] - csr->offsets[v];
+                local[count++] = v;
+                if (count == BFS_LOCAL_BUFFER) {
+                    bfs_flush(ws->next, nextSize, local, count);
+                    count = 0;
+                }
+            }
+        }
+        if (count > 0) {
+            bfs_flush(ws->next, nextSize, local, count);
+        }
     }
-    floyd_warshall(graph, dist);
-
-    // Initialiser les variables
-    bool* visited = (bool*)calloc(V, sizeof(bool));
-    int* path = (int*)malloc(V * sizeof(int));
-    float total_cost = 0;
-
-    int current = 0; // Commencer par le sommet 0
-    visited[current] = true;
-    path[0] = current;
+    return scout;
+}
 
-    for (int i = 1; i < V; i++) {
-        int next = find_nearest_neighbor(current, visited, dist, V);
-        if (next == -1) {
-            printf("Erreur : Aucun sommet accessible.\n");
-            return;
+// Fonction pour une étape ascendante : chaque sommet non atteint cherche un voisin dans la frontière
+// Les sommets sont répartis par mots de 64 : chaque mot des bitmaps n'est écrit que par un thread.
+// Suppose un filtre d'arcs symétrique. Retourne le nombre de sommets atteints à cette étape.
+long bfs_bottom_up_step(const CSRGraph* csr, BfsWorkspace* ws, int* hops, int* parent, int level) {
+    int V = csr->V;
+    int words = (V + 63) / 64;
+    long awake = 0;
+
+    #pragma omp parallel for schedule(dynamic, 16) reduction(+ : awake)
+    for (int w = 0; w < words; w++) {
+        uint64_t found = 0;
+        uint64_t pending = ~ws->visited[w];
+        if (w == words - 1 && (V & 63) != 0) {
+            pending &= (1ULL << (V & 63)) - 1;
         }
-
-        total_cost += dist[current][next];
-        visited[next] = true;
-        path[i] = next;
-        current = next;
+        while (pending != 0) {
+            int bit = __builtin_ctzll(pending);
+            pending &= pending - 1;
+            int v = w * 64 + bit;
+            for (int a = csr->offsets[v]; a < csr->offsets[v + 1]; a++) {
+                int u = csr->targets[a];
+                if (CSR_ARC_ALLOWED(csr, a) && ((ws->frontierBits[u >> 6] >> (u & 63)) & 1)) {
+                    parent[v] = u;
+                    hops[v] = level + 1;
+                    found |= 1ULL << bit;
+                    awake++;
+                    break;
+                }
+            }
+        }
+        ws->nextBits[w] = found;
+        ws->visited[w] |= found;
     }
+    return awake;
+}
 
-    // Retour au point de départ
-    total_cost += dist[current][path[0]];
+// Fonction pour convertir la frontière bitmap en liste de sommets
+int bfs_bits_to_queue(const CSRGraph* csr, BfsWorkspace* ws) {
+    int words = (csr->V + 63) / 64;
+    int size = 0;
+
+    #pragma omp parallel
+    {
+        int local[BFS_LOCAL_BUFFER];
+        int count = 0;
+
+        #pragma omp for schedule(static) nowait
+        for (int w = 0; w < words; w++) {
+            uint64_t bits = ws->frontierBits[w];
+            while (bits != 0) {
+                local[count++] = w * 64 + __builtin_ctzll(bits);
+                bits &= bits - 1;
+                if (count == BFS_LOCAL_BUFFER) {
+                    bfs_flush(ws->frontier, &size, local, count);
+                    count = 0;
+                }
+            }
+        }
+        if (count > 0) {
+            bfs_flush(ws->frontier, &size, local, count);
+        }
+    }
+    return size;
+}
 
-    // Afficher le chemin et le coût total
-    printf("Chemin glouton : ");
-    for (int i = 0; i < V; i++) {
-        printf("%d -> ", path[i]);
+// Fonction pour un parcours en largeur à direction optimisée depuis src (Beamer et al.)
+// hops[v] reçoit le nombre d'arcs du plus court chemin (-1 si inaccessible) et parent[v] son
+// prédécesseur (parent[src] = src, -1 si inaccessible). Les étapes descendantes (frontière
+// petite) et ascendantes (frontière couvrant une grande part des arcs restants) alternent
+// selon BFS_ALPHA et BFS_BETA. Les distances ne dépendent pas du nombre de threads ; parmi
+// plusieurs parents possibles, celui retenu peut varier. L'espace de travail est agrandi si le
+// graphe dépasse sa capacité. Retourne le nombre de sommets atteints, ou -1 en cas d'erreur.
+int bfs_csr(const CSRGraph* csr, int src, int* hops, int* parent, BfsWorkspace* ws) {
+    int V = csr->V;
+    int words = (V + 63) / 64;
+    if (src < 0 || src >= V) {
+        fprintf(stderr, "Erreur : Sommet source %d hors limites (%d sommets).\n", src, V);
+        return -1;
+    }
+    if (!reserve_bfs_workspace(ws, V)) {
+        return -1;
     }
-    printf("%d\n", path[0]);
-    printf("Coût total : %.2f\n", total_cost);
 
-    // Libérer la mémoire
-    for (int i = 0; i < V; i++) {
-        free(dist[i]);
+    #pragma omp parallel for schedule(static)
+    for (int v = 0; v < V; v++) {
+        hops[v] = -1;
+        parent[v] = -1;
     }
-    free(dist);
-    free(visited);
-    free(path);
+    memset(ws->visited, 0, (words + 1) * sizeof(uint64_t));
+
+    hops[src] = 0;
+    parent[src] = src;
+    ws->visited[src >> 6] |= 1ULL << (src & 63);
+    ws->frontier[0] = src;
+    int frontierSize = 1;
+    int reached = 1;
+    int level = 0;
+    long edgesToCheck = csr->A;
+    long scout = csr->offsets[src + 1] - csr->offsets[src];
+
+    while (frontierSize > 0) {
+        if (scout > edgesToCheck / BFS_ALPHA) {
+            // Frontière volumineuse : étapes ascendantes tant qu'elle reste grande ou croît
+            memset(ws->frontierBits, 0, (words + 1) * sizeof(uint64_t));
+            for (int i = 0; i < frontierSize; i++) {
+                int v = ws->frontier[i];
+                ws->frontierBits[v >> 6] |= 1ULL << (v & 63);
+            }
+            long awake = frontierSize;
+            long previous;
+            do {
+                previous = awake;
+                awake = bfs_bottom_up_step(csr, ws, hops, parent, level);
+                level++;
+                reached += awake;
+                uint64_t* tmp = ws->frontierBits;
+                ws->frontierBits = ws->nextBits;
+                ws->nextBits = tmp;
+            } while (awake >= previous || awake > V / BFS_BETA);
+            frontierSize = bfs_bits_to_queue(csr, ws);
+            scout = 1;
+        } else {
+            edgesToCheck -= scout;
+            int nextSize;
+            scout = bfs_top_down_step(csr, ws, frontierSize, &nextSize, hops, parent, level);
+            level++;
+            reached += nextSize;
+            frontierSize = nextSize;
+            int* tmp = ws->frontier;
+            ws->frontier = ws->next;
+            ws->next = tmp;
+        }
+    }
+    return reached;
 }
 
-// Structure pour représenter une livraison
+#define MSBFS_WORDS 4                   // mots de 64 bits par sommet
+#define MSBFS_BATCH (64 * MSBFS_WORDS)  // sources parcourues simultanément (256)
+
+// Fonction pour calculer les distances en nombre d'arcs depuis plusieurs sources (BFS multi-sources)
+// Les sources sont traitées par lots de MSBFS_BATCH : chaque sommet porte un masque de bits
+// (un bit par source du lot) pour les sources qui l'ont déjà atteint (seen) et celles qui
+// l'atteignent au niveau courant (visit). Un arc propage d'un coup tout le masque de son origine,
+// si bien que le travail est partagé entre les sources dont les frontières se recouvrent.
+// Le gain est maximal sur un graphe de faible diamètre ; sur un réseau maillé de grand
+// diamètre avec des sources dispersées, les frontières se recouvrent peu et des appels
+// successifs à bfs_csr peuvent rester plus rapides.
+// hops reçoit V lignes de sourceCount entiers : hops[v * sourceCount + i] est la distance de
+// sources[i] à v (-1 si inaccessible). Les distances d'un sommet sont contiguës, ce qui garde
+// les écritures d'un lot groupées. Les arcs exclus par le filtre de la vue sont ignorés.
+void multi_source_bfs(const CSRGraph* csr, const int* sources, int sourceCount, int* hops) {
+    int V = csr->V;
+    size_t cells = (size_t)V * MSBFS_WORDS;
+    uint64_t* seen = (uint64_t*)malloc((cells + 1) * sizeof(uint64_t));
+    uint64_t* visit = (uint64_t*)malloc((cells + 1) * sizeof(uint64_t));
+    uint64_t* visitNext = (uint64_t*)calloc(cells + 1, sizeof(uint64_t));
+    unsigned char* touched = (unsigned char*)calloc(V + 1, sizeof(unsigned char));
+    int* active = (int*)malloc((V + 1) * sizeof(int));
+    int* reached = (int*)malloc((V + 1) * sizeof(int));
+
+    #pragma omp parallel for schedule(static)
+    for (long i = 0; i < (long)sourceCount * V; i++) {
+        hops[i] = -1;
+    }
+
+    for (int batch = 0; batch < sourceCount; batch += MSBFS_BATCH) {
+        int count = (sourceCount - batch < MSBFS_BATCH) ? sourceCount - batch : MSBFS_BATCH;
+        memset(seen, 0, cells * sizeof(uint64_t));
+        memset(visit, 0, cells * sizeof(uint64_t));
+
+        // Niveau 0 : chaque source s'atteint elle-même
+        int activeCount = 0;
+        for (int i = 0; i < count; i++) {
+            int s = sources[batch + i];
+            if (!touched[s]) {
+                touched[s] = 1;
+                active[activeCount++] = s;
+            }
+            seen[(size_t)s * MSBFS_WORDS + (i >> 6)] |= 1ULL << (i & 63);
+            visit[(size_t)s * MSBFS_WORDS + (i >> 6)] |= 1ULL << (i & 63);
+            hops[(size_t)s * sourceCount + batch + i] = 0;
+        }
+        for (int i = 0; i < activeCount; i++) {
+            touched[active[i]] = 0;
+        }
+
+        for (int level = 1; activeCount > 0; level++) {
+            int reachedCount = 0;
+
+            // Propagation : les masques des sommets actifs sont poussés vers leurs voisins.
+            // seen n'est pas modifié pendant cette phase ; seuls les bits nouveaux sont écrits.
+            #pragma omp parallel
+            {
+                int local[BFS_LOCAL_BUFFER];
+                int localCount = 0;
+
+                #pragma omp for schedule(dynamic, 64) nowait
+                for (int i = 0; i < activeCount; i++) {
+                    int v = active[i];
+                    const uint64_t* bits = &visit[(size_t)v * MSBFS_WORDS];
+                    for (int a = csr->offsets[v]; a < csr->offsets[v + 1]; a++) {
+                        if (!CSR_ARC_ALLOWED(csr, a)) {
+                            continue;
+                        }
+                        int n = csr->targets[a];
+                        const uint64_t* known = &seen[(size_t)n * MSBFS_WORDS];
+                        uint64_t* next = &visitNext[(size_t)n * MSBFS_WORDS];
+                        bool changed = false;
+                        for (int k = 0; k < MSBFS_WORDS; k++) {
+                            if (bits[k] == 0) {
+                                continue;
+                            }
+                            uint64_t add = bits[k] & ~known[k];
+                            if (add & ~__atomic_load_n(&next[k], __ATOMIC_RELAXED)) {
+                                __atomic_fetch_or(&next[k], add, __ATOMIC_RELAXED);
+                                changed = true;
+                            }
+                        }
+                        if (changed && !__atomic_load_n(&touched[n], __ATOMIC_RELAXED) &&
+                            !__atomic_exchange_n(&touched[n], 1, __ATOMIC_RELAXED)) {
+                            local[localCount++] = n;
+                            if (localCount == BFS_LOCAL_BUFFER) {
+                                bfs_flush(reached, &reachedCount, local, localCount);
+                                localCount = 0;
+                            }
+                        }
+                    }
+                }
+                if (localCount > 0) {
+                    bfs_flush(reached, &reachedCount, local, localCount);
+                }
+            }
+
+            // Les masques du niveau courant sont consommés
+            #pragma omp parallel for schedule(static)
+            for (int i = 0; i < activeCount; i++) {
+                memset(&visit[(size_t)active[i] * MSBFS_WORDS], 0, MSBFS_WORDS * sizeof(uint64_t));
+            }
+
+            // Mise à jour : chaque sommet atteint enregistre ses nouvelles sources et devient actif
+            #pragma omp parallel for schedule(dynamic, 64)
+            for (int i = 0; i < reachedCount; i++) {
+                int n = reached[i];
+                touched[n] = 0;
+                for (int k = 0; k < MSBFS_WORDS; k++) {
+                    size_t cell = (size_t)n * MSBFS_WORDS + k;
+                    uint64_t fresh = visitNext[cell] & ~seen[cell];
+                    visitNext[cell] = 0;
+                    seen[cell] |= fresh;
+                    visit[cell] = fresh;
+                    while (fresh != 0) {
+                        int source = k * 64 + __builtin_ctzll(fresh);
+                        fresh &= fresh - 1;
+                        hops[(size_t)n * sourceCount + batch + source] = level;
+                    }
+                }
+            }
+
+            int* tmp = active;
+            active = reached;
+            reached = tmp;
+            activeCount = reachedCount;
+        }
+    }
+
+    free(seen);
+    free(visit);
+    free(visitNext);
+    free(touched);
+    free(active);
+    free(reached);
+}
+
+// Instantané des statistiques d'un graphe
+typedef struct GraphStatistics {
+    int vertices;
+    int edges;
+    int minDegree;
+    int maxDegree;
+    float averageDegree;
+    float density;
+    int components;               // -1 si le suivi de connectivité n'est pas activé
+    const int* degreeHistogram;   // degreeHistogram[d] : sommets de degré d, pour d <= maxDegree
+                                  // (valide jusqu'à la prochaine modification du graphe)
+} GraphStatistics;
+
+// Fonction pour calculer le degré moyen des sommets
+// Le nombre d'arêtes est tenu à jour par add_edge / remove_edge : aucun parcours.
+float calculate_average_degree(Graph* graph) {
+    // Chaque arête compte dans le degré de ses deux extrémités
+    return (float)(2 * graph->edge_count) / graph->V;
+}
+
+// Fonction pour calculer la densité du graphe
+float calculate_density(Graph* graph) {
+    int V = graph->V;
+    return (float)(2 * graph->edge_count) / ((float)V * (V - 1));
+}
+
+// Fonction pour obtenir en un appel les statistiques tenues à jour du graphe, en O(1)
+GraphStatistics get_graph_statistics(const Graph* graph) {
+    GraphStatistics stats;
+    stats.vertices = graph->V;
+    stats.edges = graph->edge_count;
+    stats.minDegree = (graph->V > 0) ? graph->min_degree : 0;
+    stats.maxDegree = graph->max_degree;
+    stats.averageDegree = (graph->V > 0) ? (float)(2 * graph->edge_count) / graph->V : 0.0f;
+    stats.density = (graph->V > 1) ? (float)(2 * graph->edge_count) / ((float)graph->V * (graph->V - 1)) : 0.0f;
+    stats.components = (graph->connectivity != NULL) ? graph->connectivity->components : -1;
+    stats.degreeHistogram = graph->degree_histogram;
+    return stats;
+}
+
+// Fonction pour afficher les statistiques de connectivité
+// Seul le nombre de composantes demande un parcours, si le suivi de connectivité est désactivé.
+void print_connectivity_statistics(Graph* graph) {
+    GraphStatistics stats = get_graph_statistics(graph);
+    if (stats.components < 0) {
+        stats.components = count_connected_components(graph, 0);
+    }
+
+    printf("Statistiques sur la connectivité du graphe :\n");
+    printf("Nombre de composantes connexes : %d\n", stats.components);
+    printf("Degré moyen des sommets : %.2f\n", stats.averageDegree);
+    printf("Degrés minimal / maximal : %d / %d\n", stats.minDegree, stats.maxDegree);
+    printf("Densité du graphe : %.4f\n", stats.density);
+}
+
+#define NUM_ROAD_TYPES 4              // types de route distingués par les profils de poids
+#define FORBIDDEN_WEIGHT FLT_MAX      // poids d'un arc interdit par un profil
+
+// Profil de poids multicritère (ex. client « le moins cher », « le plus rapide », « le plus sûr »)
+// poids = facteur(roadType) * (distanceCoef * distance + timeCoef * temps effectif
+//                              + costCoef * coût effectif + unreliabilityPenalty * (1 - fiabilité))
+typedef struct WeightProfile {
+    float distanceCoef;           // coefficient de la distance (km)
+    float timeCoef;               // coefficient du temps effectif (minutes)
+    float costCoef;               // coefficient du coût effectif
+    float unreliabilityPenalty;   // pénalité multipliée par (1 - fiabilité)
+    float roadTypeFactor[NUM_ROAD_TYPES]; // multiplicateur par type de route
+    int forbiddenRestrictions;    // arcs interdits si (restrictions & masque) != 0
+    int hour;                     // heure utilisée pour le temps et le coût effectifs
+} WeightProfile;
+
+// Fonction pour créer un profil neutre (tous les coefficients à 0, facteurs de route à 1)
+WeightProfile create_weight_profile(int hour) {
+    WeightProfile profile;
+    memset(&profile, 0, sizeof(profile));
+    for (int r = 0; r < NUM_ROAD_TYPES; r++) {
+        profile.roadTypeFactor[r] = 1.0f;
+    }
+    profile.hour = hour;
+    return profile;
+}
+
+// Profil « le plus rapide » : temps effectif uniquement
+WeightProfile fastest_weight_profile(int hour) {
+    WeightProfile profile = create_weight_profile(hour);
+    profile.timeCoef = 1.0f;
+    return profile;
+}
+
+// Profil « le moins cher » : coût effectif, la distance servant à départager
+WeightProfile cheapest_weight_profile(int hour) {
+    WeightProfile profile = create_weight_profile(hour);
+    profile.costCoef = 1.0f;
+    profile.distanceCoef = 0.01f;
+    return profile;
+}
+
+// Profil « le plus sûr » : temps effectif fortement pénalisé par le manque de fiabilité
+// et par les routes non revêtues
+WeightProfile safest_weight_profile(int hour) {
+    WeightProfile profile = create_weight_profile(hour);
+    profile.timeCoef = 1.0f;
+    profile.unreliabilityPenalty = 500.0f;
+    profile.roadTypeFactor[1] = 1.5f;
+    return profile;
+}
+
+// Fonction pour compiler un profil de poids en un tableau de poids par arc
+// Le calcul est fait une seule fois par profil ; weights (csr->A valeurs) peut ensuite être
+// passé à n'importe quel solveur CSR. Les arcs interdits reçoivent FORBIDDEN_WEIGHT.
+void compile_weight_profile(const CSRGraph* csr, const WeightProfile* profile, float* weights) {
+    TimePeriod period = get_time_period(profile->hour);
+    float costFactor = (period == PERIOD_MORNING || period == PERIOD_AFTERNOON) ? PEAK_COST_FACTOR : 1.0f;
+    float costCoef = profile->costCoef * costFactor;
+    const float* timeFactor = csr->timeVariation[period];
+
+    for (int a = 0; a < csr->A; a++) {
+        if (csr->restrictions[a] & profile->forbiddenRestrictions) {
+            weights[a] = FORBIDDEN_WEIGHT;
+            continue;
+        }
+        int roadType = csr->roadType[a];
+        float roadFactor = (roadType >= 0 && roadType < NUM_ROAD_TYPES) ? profile->roadTypeFactor[roadType] : 1.0f;
+        weights[a] = roadFactor * (profile->distanceCoef * csr->distance[a] +
+                                   profile->timeCoef * csr->baseTime[a] * timeFactor[a] +
+                                   costCoef * csr->cost[a] +
+                                   profile->unreliabilityPenalty * (1.0f - csr->reliability[a]));
+    }
+}
+
+#define DIST_MATRIX_ALIGN 64                       // alignement des lignes (ligne de cache, 16 floats AVX-512)
+#define DIST_MATRIX_HUGE_PAGE_BYTES (2 * 1024 * 1024) // taille à partir de laquelle on demande des pages de 2 Mo
+
+// Matrice de distances V x V en une seule allocation alignée
+// Chaque ligne commence sur une frontière de DIST_MATRIX_ALIGN octets : stride est V arrondi au
+// multiple de la largeur SIMD. Les colonnes de remplissage [V, stride) valent INF, ce qui permet aux
+// boucles vectorielles de traiter des lignes entières sans cas de bord.
+typedef struct DistanceMatrix {
+    int V;
+    int stride;                   // nombre de floats entre deux lignes consécutives
+    size_t bytes;                 // taille de l'allocation
+    float* data;                  // V * stride floats
+} DistanceMatrix;
+
+// Accès aux lignes et aux éléments d'une matrice de distances
+#define DIST_ROW(m, i) ((m)->data + (size_t)(i) * (m)->stride)
+#define DIST_AT(m, i, j) (DIST_ROW(m, i)[j])
+
+// Fonction pour créer une matrice de distances de V sommets (non initialisée hors remplissage)
+// Au-delà de DIST_MATRIX_HUGE_PAGE_BYTES, l'allocation est alignée sur 2 Mo et le noyau Linux est
+// invité à la placer sur des pages de 2 Mo (moins de défauts de TLB pendant Floyd-Warshall).
+DistanceMatrix* create_distance_matrix(int V) {
+    DistanceMatrix* m = (DistanceMatrix*)malloc(sizeof(DistanceMatrix));
+    if (m == NULL) {
+        fprintf(stderr, "Erreur : Impossible d'allouer la matrice des distances (%d sommets).\n", V);
+        return NULL;
+    }
+    int lanes = DIST_MATRIX_ALIGN / sizeof(float);
+    m->V = V;
+    m->stride = (V + lanes - 1) / lanes * lanes;
+    if (m->stride == 0) {
+        m->stride = lanes;
+    }
+    m->bytes = (size_t)(V > 0 ? V : 1) * m->stride * sizeof(float);
+
+    size_t alignment = DIST_MATRIX_ALIGN;
+    if (m->bytes >= DIST_MATRIX_HUGE_PAGE_BYTES) {
+        alignment = DIST_MATRIX_HUGE_PAGE_BYTES;
+        m->bytes = (m->bytes + alignment - 1) / alignment * alignment;
+    }
+    void* data = NULL;
+    if (posix_memalign(&data, alignment, m->bytes) != 0) {
+        fprintf(stderr, "Erreur : Impossible d'allouer la matrice des distances (%d sommets).\n", V);
+        free(m);
+        return NULL;
+    }
+    m->data = (float*)data;
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    if (alignment == DIST_MATRIX_HUGE_PAGE_BYTES) {
+        madvise(m->data, m->bytes, MADV_HUGEPAGE); // simple indication : sans effet si THP est désactivé
+    }
+#endif
+
+    for (int i = 0; i < V; i++) {
+        float* row = DIST_ROW(m, i);
+        for (int j = V; j < m->stride; j++) {
+            row[j] = INF;
+        }
+    }
+    return m;
+}
+
+// Fonction pour libérer une matrice de distances
+void free_distance_matrix(DistanceMatrix* m) {
+    if (m == NULL) {
+        return;
+    }
+    free(m->data);
+    free(m);
+}
+
+#define FLOYD_WARSHALL_TILE 64 // côté des blocs de Floyd-Warshall (multiple de 16 ; trois blocs de 16 Ko tiennent en cache L2)
+
+// Noyau de relâchement d'un bloc de Floyd-Warshall : pour k dans [k0, k1), i dans [i0, i1) et
+// j dans [j0, j1), dist[i][j] = min(dist[i][j], dist[i][k] + dist[k][j]), dans l'ordre des k
+// dist[i][k] ne change pas pendant la ligne i (dist[k][k] = 0) : il est lu une seule fois, puis
+// chaque ligne reçoit une mise à jour min-plus. Les variantes vectorielles diffusent dist[i][k]
+// dans un registre et calculent le minimum sans branchement ; elles donnent exactement les mêmes
+// valeurs que la variante scalaire. La boucle par ligne est dans chaque variante : un appel
+// indirect par segment de 64 colonnes coûterait plus cher que la mise à jour elle-même.
+typedef void (*FloydWarshallBlockKernel)(DistanceMatrix* dist, int k0, int k1, int i0, int i1, int j0, int j1);
+
+// Fonction pour mettre à jour un segment de ligne : row[j] = min(row[j], dik + rowK[j])
+void min_plus_row_scalar(float* row, const float* rowK, float dik, int n) {
+    for (int j = 0; j < n; j++) {
+        float candidate = dik + rowK[j];
+        row[j] = (candidate < row[j]) ? candidate : row[j];
+    }
+}
+
+// Variante scalaire (tous processeurs)
+void floyd_warshall_block_scalar(DistanceMatrix* dist, int k0, int k1, int i0, int i1, int j0, int j1) {
+    for (int k = k0; k < k1; k++) {
+        const float* rowK = DIST_ROW(dist, k);
+        for (int i = i0; i < i1; i++) {
+            float* rowI = DIST_ROW(dist, i);
+            min_plus_row_scalar(rowI + j0, rowK + j0, rowI[k], j1 - j0);
+        }
+    }
+}
+
+#ifdef HAVE_X86_DISPATCH
+// Variante AVX2 : 8 colonnes par itération
+__attribute__((target("avx2")))
+void floyd_warshall_block_avx2(DistanceMatrix* dist, int k0, int k1, int i0, int i1, int j0, int j1) {
+    for (int k = k0; k < k1; k++) {
+        const float* rowK = DIST_ROW(dist, k);
+        for (int i = i0; i < i1; i++) {
+            float* rowI = DIST_ROW(dist, i);
+            const __m256 dik = _mm256_set1_ps(rowI[k]);
+            int j = j0;
+            for (; j + 8 <= j1; j += 8) {
+                __m256 candidate = _mm256_add_ps(dik, _mm256_loadu_ps(rowK + j));
+                _mm256_storeu_ps(rowI + j, _mm256_min_ps(candidate, _mm256_loadu_ps(rowI + j)));
+            }
+            min_plus_row_scalar(rowI + j, rowK + j, rowI[k], j1 - j);
+        }
+    }
+}
+
+// Variante AVX-512 : 16 colonnes par itération
+__attribute__((target("avx512f")))
+void floyd_warshall_block_avx512(DistanceMatrix* dist, int k0, int k1, int i0, int i1, int j0, int j1) {
+    for (int k = k0; k < k1; k++) {
+        const float* rowK = DIST_ROW(dist, k);
+        for (int i = i0; i < i1; i++) {
+            float* rowI = DIST_ROW(dist, i);
+            const __m512 dik = _mm512_set1_ps(rowI[k]);
+            int j = j0;
+            for (; j + 16 <= j1; j += 16) {
+                __m512 candidate = _mm512_add_ps(dik, _mm512_loadu_ps(rowK + j));
+                _mm512_storeu_ps(rowI + j, _mm512_min_ps(candidate, _mm512_loadu_ps(rowI + j)));
+            }
+            min_plus_row_scalar(rowI + j, rowK + j, rowI[k], j1 - j);
+        }
+    }
+}
+#endif
+
+// Fonction pour choisir le noyau de bloc le plus rapide supporté par le processeur courant
+FloydWarshallBlockKernel select_floyd_warshall_block_kernel(void) {
+#ifdef HAVE_X86_DISPATCH
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return floyd_warshall_block_avx512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return floyd_warshall_block_avx2;
+    }
+#endif
+    return floyd_warshall_block_scalar;
+}
+
+// Fonction pour appliquer Floyd-Warshall par blocs de tile x tile sur une matrice initialisée
+// Pour chaque bloc diagonal K : (1) le bloc (K, K) lui-même, (2) les panneaux de la ligne K et de
+// la colonne K, qui ne dépendent que du bloc diagonal, (3) tous les autres blocs (I, J), qui ne
+// lisent que les panneaux (I, K) et (K, J). Chaque bloc est relu depuis le cache pendant tile
+// itérations de k au lieu de parcourir toute la matrice à chaque k. Les blocs des phases 2 et 3
+// sont indépendants et répartis entre les threads. Les blocs de la dernière colonne s'étendent
+// sur les colonnes de remplissage (INF) pour que les segments restent des multiples de la
+// largeur SIMD.
+void floyd_warshall_blocked(DistanceMatrix* dist, int tile) {
+    int V = dist->V;
+    if (tile <= 0) {
+        tile = FLOYD_WARSHALL_TILE;
+    }
+    int blocks = (V + tile - 1) / tile;
+    FloydWarshallBlockKernel kernel = select_floyd_warshall_block_kernel();
+
+    for (int kb = 0; kb < blocks; kb++) {
+        int k0 = kb * tile;
+        int k1 = (k0 + tile < V) ? k0 + tile : V;
+
+        int kj1 = (k0 + tile < V) ? k0 + tile : dist->stride; // colonnes du bloc diagonal
+
+        // Phase 1 : bloc diagonal
+        kernel(dist, k0, k1, k0, k1, k0, kj1);
+
+        // Phase 2 : panneaux de la ligne et de la colonne du bloc diagonal
+        #pragma omp parallel for schedule(dynamic, 1)
+        for (int b = 0; b < blocks; b++) {
+            if (b == kb) {
+                continue;
+            }
+            int b0 = b * tile;
+            int b1 = (b0 + tile < V) ? b0 + tile : V;
+            int bj1 = (b0 + tile < V) ? b0 + tile : dist->stride;
+            kernel(dist, k0, k1, k0, k1, b0, bj1);
+            kernel(dist, k0, k1, b0, b1, k0, kj1);
+        }
+
+        // Phase 3 : blocs restants
+        #pragma omp parallel for schedule(dynamic, 1)
+        for (int ib = 0; ib < blocks; ib++) {
+            if (ib == kb) {
+                continue;
+            }
+            int i0 = ib * tile;
+            int i1 = (i0 + tile < V) ? i0 + tile : V;
+            for (int jb = 0; jb < blocks; jb++) {
+                if (jb == kb) {
+                    continue;
+                }
+                int j0 = jb * tile;
+                int j1 = (j0 + tile < V) ? j0 + tile : dist->stride;
+                kernel(dist, k0, k1, i0, i1, j0, j1);
+            }
+        }
+    }
+}
+
+// Fonction pour appliquer l'algorithme de Floyd-Warshall sur un graphe CSR avec des poids par arc
+void floyd_warshall_csr(const CSRGraph* csr, const float* weights, DistanceMatrix* dist) {
+    int V = csr->V;
+
+    // Initialiser la matrice des distances
+    for (int i = 0; i < V; i++) {
+        float* row = DIST_ROW(dist, i);
+        for (int j = 0; j < V; j++) {
+            row[j] = INF;
+        }
+        row[i] = 0;
+
+        // En cas d'arêtes multiples, garder la moins chère
+        for (int a = csr->offsets[i]; a < csr->offsets[i + 1]; a++) {
+            if (!CSR_ARC_ALLOWED(csr, a)) {
+                continue;
+            }
+            int j = csr->targets[a];
+            if (i != j && weights[a] < row[j]) {
+                row[j] = weights[a];
+            }
+        }
+    }
+
+    // Appliquer l'algorithme de Floyd-Warshall
+    floyd_warshall_blocked(dist, FLOYD_WARSHALL_TILE);
+}
+
+// Fonction pour calculer la matrice des plus courts chemins d'un graphe selon un profil
+// Sans profil (NULL), le poids d'une arête est sa distance.
+void compute_distance_matrix(Graph* graph, const WeightProfile* profile, DistanceMatrix* dist) {
+    CSRGraph* csr = build_csr_graph(graph);
+    if (profile == NULL) {
+        floyd_warshall_csr(csr, csr->distance, dist);
+    } else {
+        float* weights = (float*)malloc(csr->A * sizeof(float));
+        compile_weight_profile(csr, profile, weights);
+        floyd_warshall_csr(csr, weights, dist);
+        free(weights);
+    }
+    free_csr_graph(csr);
+}
+
+// Fonction pour appliquer l'algorithme de Floyd-Warshall
+void floyd_warshall(Graph* graph, DistanceMatrix* dist) {
+    compute_distance_matrix(graph, NULL, dist);
+}
+
+// Fonction pour calculer le coût total d'un chemin donné
+float calculate_path_cost(int* path, int V, const DistanceMatrix* dist) {
+    float cost = 0;
+    for (int i = 0; i < V - 1; i++) {
+        cost += DIST_AT(dist, path[i], path[i + 1]);
+    }
+    cost += DIST_AT(dist, path[V - 1], path[0]); // Retour au point de départ
+    return cost;
+}
+
+// Fonction pour générer toutes les permutations des sommets
+void tsp_permute(int* path, int l, int r, const DistanceMatrix* dist, float* min_cost, int* best_path, int V) {
+    if (l == r) {
+        float cost = calculate_path_cost(path, V, dist);
+        if (cost < *min_cost) {
+            *min_cost = cost;
+            memcpy(best_path, path, V * sizeof(int));
+        }
+        return;
+    }
+
+    for (int i = l; i <= r; i++) {
+        // Échanger les sommets
+        int temp = path[l];
+        path[l] = path[i];
+        path[i] = temp;
+
+        tsp_permute(path, l + 1, r, dist, min_cost, best_path, V);
+
+        // Revenir à l'état précédent
+        temp = path[l];
+        path[l] = path[i];
+        path[i] = temp;
+    }
+}
+
+// Fonction principale pour résoudre le TSP (profil NULL : distances nominales)
+void solve_tsp(Graph* graph, const WeightProfile* profile) {
+    int V = graph->V;
+
+    // Calculer la matrice des distances avec Floyd-Warshall
+    DistanceMatrix* dist = create_distance_matrix(V);
+    if (dist == NULL) {
+        return;
+    }
+    compute_distance_matrix(graph, profile, dist);
+
+    // Initialiser les variables pour le TSP
+    int* path = (int*)malloc(V * sizeof(int));
+    int* best_path = (int*)malloc(V * sizeof(int));
+    for (int i = 0; i < V; i++) {
+        path[i] = i;
+    }
+
+    float min_cost = INF;
+
+    // Trouver le chemin optimal
+    tsp_permute(path, 0, V - 1, dist, &min_cost, best_path, V);
+
+    // Afficher le résultat
+    printf("Chemin optimal : ");
+    for (int i = 0; i < V; i++) {
+        printf("%d -> ", best_path[i]);
+    }
+    printf("%d\n", best_path[0]);
+    printf("Coût minimal : %.2f\n", min_cost);
+
+    // Libérer la mémoire
+    free_distance_matrix(dist);
+    free(path);
+    free(best_path);
+}
+
+// Fonction pour ajuster les poids des arêtes en fonction des contraintes temporelles
+float adjust_edge_weight(EdgeAttr attr, int hour) {
+    // Poids de base : distance, modulée par la variation temporelle de l'arête
+    float adjusted_weight = attr.distance * attr.timeVariation[get_time_period(hour)];
+
+    // Ajouter un coût variable (par exemple, coût monétaire)
+    adjusted_weight += attr.cost * COST_WEIGHT_SCALE; // Normaliser le coût pour l'ajouter au poids
+
+    return adjusted_weight;
+}
+
+// Noyau de calcul en masse du poids composite : weights[a] = distance[a] * factor[a] + cost[a] * 0.001
+// Les variantes vectorielles effectuent les mêmes opérations que la variante scalaire
+// (multiplication puis addition, sans FMA).
+typedef void (*EdgeWeightKernel)(const float* distance, const float* factor, const float* cost,
+                                 float* weights, int n);
+
+// Variante scalaire (tous processeurs)
+void edge_weight_kernel_scalar(const float* distance, const float* factor, const float* cost,
+                               float* weights, int n) {
+    for (int a = 0; a < n; a++) {
+        weights[a] = distance[a] * factor[a] + cost[a] * COST_WEIGHT_SCALE;
+    }
+}
+
+#ifdef HAVE_X86_DISPATCH
+// Variante SSE : 4 arcs par itération
+__attribute__((target("sse2")))
+void edge_weight_kernel_sse(const float* distance, const float* factor, const float* cost,
+                            float* weights, int n) {
+    const __m128 scale = _mm_set1_ps(COST_WEIGHT_SCALE);
+    int a = 0;
+    for (; a + 4 <= n; a += 4) {
+        __m128 d = _mm_loadu_ps(distance + a);
+        __m128 f = _mm_loadu_ps(factor + a);
+        __m128 c = _mm_loadu_ps(cost + a);
+        _mm_storeu_ps(weights + a, _mm_add_ps(_mm_mul_ps(d, f), _mm_mul_ps(c, scale)));
+    }
+    edge_weight_kernel_scalar(distance + a, factor + a, cost + a, weights + a, n - a);
+}
+
+// Variante AVX2 : 8 arcs par itération
+__attribute__((target("avx2")))
+void edge_weight_kernel_avx2(const float* distance, const float* factor, const float* cost,
+                             float* weights, int n) {
+    const __m256 scale = _mm256_set1_ps(COST_WEIGHT_SCALE);
+    int a = 0;
+    for (; a + 8 <= n; a += 8) {
+        __m256 d = _mm256_loadu_ps(distance + a);
+        __m256 f = _mm256_loadu_ps(factor + a);
+        __m256 c = _mm256_loadu_ps(cost + a);
+        _mm256_storeu_ps(weights + a, _mm256_add_ps(_mm256_mul_ps(d, f), _mm256_mul_ps(c, scale)));
+    }
+    edge_weight_kernel_scalar(distance + a, factor + a, cost + a, weights + a, n - a);
+}
+#endif
+
+// Fonction pour choisir le noyau le plus rapide supporté par le processeur courant
+EdgeWeightKernel select_edge_weight_kernel(void) {
+#ifdef HAVE_X86_DISPATCH
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return edge_weight_kernel_avx2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return edge_weight_kernel_sse;
+    }
+#endif
+    return edge_weight_kernel_scalar;
+}
+
+// Fonction pour calculer le poids composite de tous les arcs pour une heure donnée
+// Le résultat est écrit dans weights (csr->A valeurs) et peut être passé aux solveurs CSR.
+void compute_edge_weights(const CSRGraph* csr, int hour, float* weights) {
+    select_edge_weight_kernel()(csr->distance, csr->timeVariation[get_time_period(hour)],
+                                csr->cost, weights, csr->A);
+}
+
+// Fonction pour précalculer les poids effectifs de chaque arc pour toutes les périodes
+// Chaque période dispose de son propre tableau contigu : une requête à une heure donnée
+// n'a plus qu'à sélectionner le tableau (voir get_period_weights).
+void precompute_period_weights(CSRGraph* csr) {
+    EdgeWeightKernel kernel = select_edge_weight_kernel();
+    for (int p = 0; p < NUM_PERIODS; p++) {
+        if (csr->periodWeights[p] == NULL) {
+            csr->periodWeights[p] = (float*)malloc(csr->A * sizeof(float));
+        }
+        kernel(csr->distance, csr->timeVariation[p], csr->cost, csr->periodWeights[p], csr->A);
+    }
+}
+
+// Fonction pour obtenir le tableau des poids précalculés correspondant à une heure
+// Sans précalcul préalable, seule la période demandée est calculée (puis conservée).
+const float* get_period_weights(CSRGraph* csr, int hour) {
+    TimePeriod period = get_time_period(hour);
+    if (csr->periodWeights[period] == NULL) {
+        csr->periodWeights[period] = (float*)malloc(csr->A * sizeof(float));
+        select_edge_weight_kernel()(csr->distance, csr->timeVariation[period], csr->cost,
+                                    csr->periodWeights[period], csr->A);
+    }
+    return csr->periodWeights[period];
+}
+
+// Fonction de Bellman-Ford sur un graphe CSR avec des poids précalculés par arc
+bool bellman_ford_csr(const CSRGraph* csr, const float* weights, int src, float* dist) {
+    int V = csr->V;
+
+    // Initialiser les distances à l'infini
+    for (int i = 0; i < V; i++) {
+        dist[i] = FLT_MAX;
+    }
+    dist[src] = 0; // La distance à la source est 0
+
+    // Relaxer les arêtes V-1 fois (arrêt anticipé si une passe ne change rien)
+    for (int i = 1; i <= V - 1; i++) {
+        bool updated = false;
+        for (int u = 0; u < V; u++) {
+            if (dist[u] == FLT_MAX) {
+                continue;
+            }
+            for (int a = csr->offsets[u]; a < csr->offsets[u + 1]; a++) {
+                if (!CSR_ARC_ALLOWED(csr, a)) {
+                    continue;
+                }
+                int dest = csr->targets[a];
+                if (dist[u] + weights[a] < dist[dest]) {
+                    dist[dest] = dist[u] + weights[a];
+                    updated = true;
+                }
+            }
+        }
+        if (!updated) {
+            break;
+        }
+    }
+
+    // Vérifier les cycles de poids négatif
+    for (int u = 0; u < V; u++) {
+        if (dist[u] == FLT_MAX) {
+            continue;
+        }
+        for (int a = csr->offsets[u]; a < csr->offsets[u + 1]; a++) {
+            if (!CSR_ARC_ALLOWED(csr, a)) {
+                continue;
+            }
+            if (dist[u] + weights[a] < dist[csr->targets[a]]) {
+                printf("Le graphe contient un cycle de poids négatif.\n");
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+// Fonction principale de Bellman-Ford
+// Le CSR est construit pour cette seule requête et seuls les poids de l'heure demandée sont
+// calculés. Pour des requêtes répétées, garder un CSR et appeler bellman_ford_csr avec
+// get_period_weights. Les arcs interdits par forbiddenMask sont exclus par une vue filtrée.
+bool bellman_ford(Graph* graph, int src, int hour, int forbiddenMask, float* dist) {
+    CSRGraph* csr = build_csr_graph(graph);
+    float* weights = (float*)malloc((csr->A + 1) * sizeof(float));
+    uint64_t* filter = (forbiddenMask != 0) ? build_restriction_filter(csr, forbiddenMask) : NULL;
+    CSRGraph view = filtered_csr_view(csr, filter);
+    compute_edge_weights(csr, hour, weights);
+    bool result = bellman_ford_csr(&view, weights, src, dist);
+    free(filter);
+    free(weights);
+    free_csr_graph(csr);
+    return result;
+}
+
+// Tas binaire minimal indexé par sommet, avec diminution de clé
+typedef struct MinHeap {
+    int size;                     // nombre d'éléments dans le tas
+    int* heap;                    // sommets ordonnés par clé
+    int* position;                // position de chaque sommet dans le tas (-1 si absent)
+    float* key;                   // clé de chaque sommet
+} MinHeap;
+
+// Fonction pour créer un tas pouvant contenir les sommets [0, capacity)
+MinHeap* create_min_heap(int capacity) {
+    MinHeap* heap = (MinHeap*)malloc(sizeof(MinHeap));
+    heap->size = 0;
+    heap->heap = (int*)malloc(capacity * sizeof(int));
+    heap->position = (int*)malloc(capacity * sizeof(int));
+    heap->key = (float*)malloc(capacity * sizeof(float));
+    for (int i = 0; i < capacity; i++) {
+        heap->position[i] = -1;
+    }
+    return heap;
+}
+
+// Fonction pour libérer un tas
+void free_min_heap(MinHeap* heap) {
+    free(heap->heap);
+    free(heap->position);
+    free(heap->key);
+    free(heap);
+}
+
+// Fonction pour faire remonter l'élément situé à la position i
+void heap_sift_up(MinHeap* heap, int i) {
+    int v = heap->heap[i];
+    float k = heap->key[v];
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        int p = heap->heap[parent];
+        if (heap->key[p] <= k) {
+            break;
+        }
+        heap->heap[i] = p;
+        heap->position[p] = i;
+        i = parent;
+    }
+    heap->heap[i] = v;
+    heap->position[v] = i;
+}
+
+// Fonction pour faire descendre l'élément situé à la position i
+void heap_sift_down(MinHeap* heap, int i) {
+    int v = heap->heap[i];
+    float k = heap->key[v];
+    while (true) {
+        int child = 2 * i + 1;
+        if (child >= heap->size) {
+            break;
+        }
+        if (child + 1 < heap->size && heap->key[heap->heap[child + 1]] < heap->key[heap->heap[child]]) {
+            child++;
+        }
+        int c = heap->heap[child];
+        if (heap->key[c] >= k) {
+            break;
+        }
+        heap->heap[i] = c;
+        heap->position[c] = i;
+        i = child;
+    }
+    heap->heap[i] = v;
+    heap->position[v] = i;
+}
+
+// Fonction pour insérer un sommet ou diminuer sa clé s'il est déjà dans le tas
+void heap_push_or_decrease(MinHeap* heap, int v, float key) {
+    heap->key[v] = key;
+    if (heap->position[v] < 0) {
+        heap->heap[heap->size] = v;
+        heap->position[v] = heap->size;
+        heap->size++;
+    }
+    heap_sift_up(heap, heap->position[v]);
+}
+
+// Fonction pour extraire le sommet de clé minimale
+int heap_pop(MinHeap* heap) {
+    int top = heap->heap[0];
+    heap->position[top] = -1;
+    heap->size--;
+    if (heap->size > 0) {
+        heap->heap[0] = heap->heap[heap->size];
+        heap_sift_down(heap, 0);
+    }
+    return top;
+}
+
+// Fonction pour vider le tas sans parcourir tous les sommets
+void heap_clear(MinHeap* heap) {
+    for (int i = 0; i < heap->size; i++) {
+        heap->position[heap->heap[i]] = -1;
+    }
+    heap->size = 0;
+}
+
+// Espace de travail réutilisable pour les recherches de type Dijkstra
+// Seuls les sommets atteints par la requête précédente sont réinitialisés. Les recherches
+// l'agrandissent (reserve_dijkstra_workspace) si le graphe compte plus de V sommets.
+typedef struct DijkstraWorkspace {
+    int V;                        // nombre de sommets pris en charge
+    MinHeap* heap;
+    float* dist;                  // distance ou heure d'arrivée (FLT_MAX si non atteint)
+    int* parent;                  // prédécesseur sur le meilleur chemin (-1 pour la source)
+    int* touched;                 // sommets atteints par la dernière requête
+    int touchedCount;
+    int periodEnd[24];            // heure de fin de la période en cours, pour chaque heure
+} DijkstraWorkspace;
+
+// Fonction pour créer un espace de travail pour un graphe de V sommets
+DijkstraWorkspace* create_dijkstra_workspace(int V) {
+    DijkstraWorkspace* ws = (DijkstraWorkspace*)malloc(sizeof(DijkstraWorkspace));
+    ws->V = V;
+    ws->heap = create_min_heap(V);
+    ws->dist = (float*)malloc(V * sizeof(float));
+    ws->parent = (int*)malloc(V * sizeof(int));
+    ws->touched = (int*)malloc(V * sizeof(int));
+    ws->touchedCount = 0;
+    for (int i = 0; i < V; i++) {
+        ws->dist[i] = FLT_MAX;
+        ws->parent[i] = -1;
+    }
+
+    // Fin de la plage d'heures consécutives ayant la même période (peut dépasser 24)
+    for (int hour = 0; hour < 24; hour++) {
+        int end = hour + 1;
+        while (end < hour + 24 && get_time_period(end) == get_time_period(hour)) {
+            end++;
+        }
+        ws->periodEnd[hour] = end;
+    }
+    return ws;
+}
+
+// Fonction pour agrandir un espace de travail à V sommets
+// Les nouveaux sommets sont marqués non atteints et le tas est recréé à la nouvelle taille.
+// Retourne false si une allocation échoue (ws->V reste alors inchangé).
+bool reserve_dijkstra_workspace(DijkstraWorkspace* ws, int V) {
+    if (V <= ws->V) {
+        return true;
+    }
+    float* dist = (float*)realloc(ws->dist, V * sizeof(float));
+    if (dist != NULL) {
+        ws->dist = dist;
+    }
+    int* parent = (int*)realloc(ws->parent, V * sizeof(int));
+    if (parent != NULL) {
+        ws->parent = parent;
+    }
+    int* touched = (int*)realloc(ws->touched, V * sizeof(int));
+    if (touched != NULL) {
+        ws->touched = touched;
+    }
+    MinHeap* heap = (dist != NULL && parent != NULL && touched != NULL) ? create_min_heap(V) : NULL;
+    if (heap == NULL || heap->heap == NULL || heap->position == NULL || heap->key == NULL) {
+        if (heap != NULL) {
+            free_min_heap(heap);
+        }
+        fprintf(stderr, "Erreur : Allocation de l'espace de travail Dijkstra (%d sommets) impossible.\n", V);
+        return false;
+    }
+    for (int i = ws->V; i < V; i++) {
+        ws->dist[i] = FLT_MAX;
+        ws->parent[i] = -1;
+    }
+    free_min_heap(ws->heap);
+    ws->heap = heap;
+    ws->V = V;
+    return true;
+}
+
+// Fonction pour libérer un espace de travail
+void free_dijkstra_workspace(DijkstraWorkspace* ws) {
+    free_min_heap(ws->heap);
+    free(ws->dist);
+    free(ws->parent);
+    free(ws->touched);
+    free(ws);
+}
+
+// Fonction pour remettre l'espace de travail à zéro avant une nouvelle requête
+void reset_dijkstra_workspace(DijkstraWorkspace* ws) {
+    for (int i = 0; i < ws->touchedCount; i++) {
+        ws->dist[ws->touched[i]] = FLT_MAX;
+        ws->parent[ws->touched[i]] = -1;
+    }
+    ws->touchedCount = 0;
+    heap_clear(ws->heap);
+}
+
+// Fonction pour calculer l'heure d'arrivée au bout d'un arc en partant à l'heure departure
+// Les temps sont en minutes depuis minuit (departure peut dépasser 24h) ; periodEnd est la
+// table des fins de période d'un DijkstraWorkspace. Le temps nominal
+// baseTime est parcouru à une vitesse qui change avec la période : dans une période de facteur f,
+// une minute réelle couvre 1/f minute nominale. Partir plus tard ne fait donc jamais arriver
+// plus tôt (propriété FIFO), même si l'arc traverse un changement de période.
+float td_arrival_time(const CSRGraph* csr, int a, float departure, const int* periodEnd) {
+    float remaining = csr->baseTime[a]; // temps nominal restant à parcourir
+    float t = departure;
+
+    while (remaining > 0) {
+        int hour = (int)floorf(t / 60.0f);
+        int hourOfDay = ((hour % 24) + 24) % 24; // un départ négatif tombe la veille
+        float factor = csr->timeVariation[get_time_period(hourOfDay)][a];
+        if (factor <= 0) {
+            factor = 1.0f;
+        }
+
+        int end = hour - hourOfDay + periodEnd[hourOfDay];
+        float available = end * 60.0f - t;
+
+        if (remaining * factor <= available) {
+            return t + remaining * factor;
+        }
+        remaining -= available / factor;
+        t = end * 60.0f;
+    }
+    return t;
+}
+
+// Fonction pour tester les extrémités d'une requête de plus court chemin sur V sommets
+// src doit être dans [0, V) ; dst aussi, ou négatif (aucune destination : arbre complet).
+bool route_endpoints_valid(int V, int src, int dst) {
+    return src >= 0 && src < V && dst < V;
+}
+
+// Fonction de Dijkstra dépendant du temps sur un graphe CSR
+// Le coût d'un arc dépend de l'heure d'arrivée à son origine (voir td_arrival_time).
+// Si dst >= 0, la recherche s'arrête dès que dst est définitivement atteint.
+// Retourne l'heure d'arrivée au plus tôt à dst (FLT_MAX si inaccessible, ou si src / dst est
+// hors limites) ; les heures d'arrivée et les prédécesseurs de tous les sommets atteints restent dans ws.
+float td_dijkstra(const CSRGraph* csr, int src, int dst, float departure, DijkstraWorkspace* ws) {
+    if (!route_endpoints_valid(csr->V, src, dst)) {
+        fprintf(stderr, "Erreur : Trajet %d -> %d hors limites (%d sommets).\n", src, dst, csr->V);
+        return FLT_MAX;
+    }
+    if (!reserve_dijkstra_workspace(ws, csr->V)) {
+        return FLT_MAX;
+    }
+    reset_dijkstra_workspace(ws);
+    MinHeap* heap = ws->heap;
+
+    ws->dist[src] = departure;
+    ws->touched[ws->touchedCount++] = src;
+    heap_push_or_decrease(heap, src, departure);
+
+    while (heap->size > 0) {
+        int u = heap_pop(heap);
+        if (u == dst) {
+            break;
+        }
+
+        float t = ws->dist[u];
+        for (int a = csr->offsets[u]; a < csr->offsets[u + 1]; a++) {
+            if (!CSR_ARC_ALLOWED(csr, a)) {
+                continue;
+            }
+            int v = csr->targets[a];
+            float arrival = td_arrival_time(csr, a, t, ws->periodEnd);
+            if (arrival < ws->dist[v]) {
+                if (ws->dist[v] == FLT_MAX) {
+                    ws->touched[ws->touchedCount++] = v;
+                }
+                ws->dist[v] = arrival;
+                ws->parent[v] = u;
+                heap_push_or_decrease(heap, v, arrival);
+            }
+        }
+    }
+
+    return (dst >= 0) ? ws->dist[dst] : departure;
+}
+
+// Fonction pour calculer le profil des heures d'arrivée en fonction de l'heure de départ
+// arrivals[i] reçoit l'arrivée au plus tôt à dst pour un départ à start + i * step (minutes),
+// pour au plus maxArrivals départs. Retourne le nombre de départs évalués, ou -1 si step <= 0
+// ou si src / dst est hors limites.
+int td_profile_query(const CSRGraph* csr, int src, int dst, float start, float end, float step,
+                     float* arrivals, int maxArrivals, DijkstraWorkspace* ws) {
+    if (!(step > 0)) {
+        fprintf(stderr, "Erreur : Pas du profil de départ invalide (%f).\n", step);
+        return -1;
+    }
+    if (!route_endpoints_valid(csr->V, src, dst)) {
+        fprintf(stderr, "Erreur : Trajet %d -> %d hors limites (%d sommets).\n", src, dst, csr->V);
+        return -1;
+    }
+    int count = 0;
+    for (float departure = start; departure <= end && count < maxArrivals; departure = start + (count * step)) {
+        arrivals[count++] = td_dijkstra(csr, src, dst, departure, ws);
+    }
+    return count;
+}
+
+// Fonction de Dijkstra sur un graphe CSR avec des poids par arc précalculés (positifs)
+// Si dst >= 0, la recherche s'arrête dès que dst est définitivement atteint.
+// Retourne la distance à dst (FLT_MAX si inaccessible, ou si src / dst est hors limites) ;
+// distances et prédécesseurs restent dans ws.
+float dijkstra_csr(const CSRGraph* csr, const float* weights, int src, int dst, DijkstraWorkspace* ws) {
+    if (!route_endpoints_valid(csr->V, src, dst)) {
+        fprintf(stderr, "Erreur : Trajet %d -> %d hors limites (%d sommets).\n", src, dst, csr->V);
+        return FLT_MAX;
+    }
+    if (!reserve_dijkstra_workspace(ws, csr->V)) {
+        return FLT_MAX;
+    }
+    reset_dijkstra_workspace(ws);
+    MinHeap* heap = ws->heap;
+
+    ws->dist[src] = 0;
+    ws->touched[ws->touchedCount++] = src;
+    heap_push_or_decrease(heap, src, 0);
+
+    while (heap->size > 0) {
+        int u = heap_pop(heap);
+        if (u == dst) {
+            break;
+        }
+
+        float d = ws->dist[u];
+        for (int a = csr->offsets[u]; a < csr->offsets[u + 1]; a++) {
+            if (!CSR_ARC_ALLOWED(csr, a)) {
+                continue;
+            }
+            int v = csr->targets[a];
+            float candidate = d + weights[a];
+            if (candidate < ws->dist[v]) {
+                if (ws->dist[v] == FLT_MAX) {
+                    ws->touched[ws->touchedCount++] = v;
+                }
+                ws->dist[v] = candidate;
+                ws->parent[v] = u;
+                heap_push_or_decrease(heap, v, candidate);
+            }
+        }
+    }
+
+    return (dst >= 0) ? ws->dist[dst] : 0;
+}
+
+#define MIN_RELIABILITY 1e-6f // Fiabilité minimale prise en compte (évite -log(0))
+
+// Itinéraire de la frontière de Pareto (temps, coût, fiabilité)
+typedef struct ParetoRoute {
+    float time;                   // temps nominal total (minutes)
+    float cost;                   // coût total
+    float reliability;            // produit des fiabilités des arêtes
+    int length;                   // nombre de sommets du chemin
+    int* path;                    // sommets du chemin, de la source à la destination
+} ParetoRoute;
+
+// Étiquettes de la recherche multicritère, stockées en colonnes contiguës
+typedef struct ParetoLabels {
+    int count;
+    int capacity;
+    float* time;
+    float* cost;
+    float* risk;                  // somme des -log(fiabilité)
+    int* node;
+    int* pred;                    // étiquette précédente (-1 pour la source)
+    bool* alive;                  // false si l'étiquette a été dominée
+} ParetoLabels;
+
+// Fonction pour ajouter une étiquette et retourner son indice
+int pareto_add_label(ParetoLabels* labels, float time, float cost, float risk, int node, int pred) {
+    if (labels->count == labels->capacity) {
+        labels->capacity = (labels->capacity > 0) ? 2 * labels->capacity : 1024;
+        labels->time = (float*)realloc(labels->time, labels->capacity * sizeof(float));
+        labels->cost = (float*)realloc(labels->cost, labels->capacity * sizeof(float));
+        labels->risk = (float*)realloc(labels->risk, labels->capacity * sizeof(float));
+        labels->node = (int*)realloc(labels->node, labels->capacity * sizeof(int));
+        labels->pred = (int*)realloc(labels->pred, labels->capacity * sizeof(int));
+        labels->alive = (bool*)realloc(labels->alive, labels->capacity * sizeof(bool));
+    }
+    int id = labels->count++;
+    labels->time[id] = time;
+    labels->cost[id] = cost;
+    labels->risk[id] = risk;
+    labels->node[id] = node;
+    labels->pred[id] = pred;
+    labels->alive[id] = true;
+    return id;
+}
+
+// Fonction pour comparer deux étiquettes dans l'ordre lexicographique (temps, coût, risque)
+bool pareto_label_less(const ParetoLabels* labels, int a, int b) {
+    if (labels->time[a] != labels->time[b]) return labels->time[a] < labels->time[b];
+    if (labels->cost[a] != labels->cost[b]) return labels->cost[a] < labels->cost[b];
+    return labels->risk[a] < labels->risk[b];
+}
+
+// Fonction pour insérer une étiquette dans le tas (ordre lexicographique)
+void pareto_heap_push(int* heap, int* size, const ParetoLabels* labels, int id) {
+    int i = (*size)++;
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (!pareto_label_less(labels, id, heap[parent])) {
+            break;
+        }
+        heap[i] = heap[parent];
+        i = parent;
+    }
+    heap[i] = id;
+}
+
+// Fonction pour extraire la plus petite étiquette du tas
+int pareto_heap_pop(int* heap, int* size, const ParetoLabels* labels) {
+    int top = heap[0];
+    int last = heap[--(*size)];
+    int i = 0;
+    while (true) {
+        int child = 2 * i + 1;
+        if (child >= *size) {
+            break;
+        }
+        if (child + 1 < *size && pareto_label_less(labels, heap[child + 1], heap[child])) {
+            child++;
+        }
+        if (!pareto_label_less(labels, heap[child], last)) {
+            break;
+        }
+        heap[i] = heap[child];
+        i = child;
+    }
+    if (*size > 0) {
+        heap[i] = last;
+    }
+    return top;
+}
+
+// Fonction pour tester si (time, cost, risk) est dominé ou égalé par une étiquette d'un sac
+bool pareto_bag_dominates(const ParetoLabels* labels, const int* bag, int bagSize,
+                          float time, float cost, float risk) {
+    for (int i = 0; i < bagSize; i++) {
+        int l = bag[i];
+        if (labels->time[l] <= time && labels->cost[l] <= cost && labels->risk[l] <= risk) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Fonction pour calculer la frontière de Pareto des itinéraires entre src et dst
+// Critères minimisés : temps nominal, coût, et -log(fiabilité) (fiabilité maximisée).
+// Recherche à étiquettes (Martins) : les étiquettes sont extraites dans l'ordre lexicographique,
+// une étiquette extraite n'est donc jamais dominée par une étiquette ultérieure. Chaque sommet
+// garde au plus maxBagSize étiquettes non dominées ; lorsque ce plafond est atteint, les
+// nouvelles étiquettes non dominantes sont abandonnées et *truncated passe à true (la frontière
+// retournée est alors un sous-ensemble de la frontière exacte).
+// Retourne le nombre d'itinéraires écrits dans *routes (à libérer avec free_pareto_routes),
+// ou -1 si les paramètres sont invalides ou si la mémoire manque.
+int pareto_routes(const CSRGraph* csr, int src, int dst, int maxBagSize,
+                  ParetoRoute** routes, bool* truncated) {
+    int V = csr->V;
+    *routes = NULL;
+    *truncated = false;
+    if (maxBagSize < 1 || src < 0 || src >= V || dst < 0 || dst >= V) {
+        fprintf(stderr, "Erreur : Paramètres de recherche Pareto invalides (src %d, dst %d, sac %d).\n",
+                src, dst, maxBagSize);
+        return -1;
+    }
+
+    ParetoLabels labels;
+    memset(&labels, 0, sizeof(labels));
+    int* bags = (int*)malloc((size_t)V * maxBagSize * sizeof(int)); // sac de chaque sommet
+    int* bagSize = (int*)calloc(V, sizeof(int));
+    if (bags == NULL || bagSize == NULL) {
+        fprintf(stderr, "Erreur : Mémoire insuffisante pour %d étiquettes par sommet.\n", maxBagSize);
+        free(bags);
+        free(bagSize);
+        return -1;
+    }
+    int heapCapacity = 1024;
+    int heapSize = 0;
+    int* heap = (int*)malloc(heapCapacity * sizeof(int));
+
+    int first = pareto_add_label(&labels, 0, 0, 0, src, -1);
+    bags[(size_t)src * maxBagSize] = first;
+    bagSize[src] = 1;
+    pareto_heap_push(heap, &heapSize, &labels, first);
+
+    while (heapSize > 0) {
+        int l = pareto_heap_pop(heap, &heapSize, &labels);
+        if (!labels.alive[l]) {
+            continue;
+        }
+        int u = labels.node[l];
+        if (u == dst) {
+            continue; // Étiquette finale : ne pas prolonger
+        }
+
+        for (int a = csr->offsets[u]; a < csr->offsets[u + 1]; a++) {
+            if (!CSR_ARC_ALLOWED(csr, a)) {
+                continue;
+            }
+            int v = csr->targets[a];
+            float reliability = (csr->reliability[a] > MIN_RELIABILITY) ? csr->reliability[a] : MIN_RELIABILITY;
+            float time = labels.time[l] + csr->baseTime[a];
+            float cost = labels.cost[l] + csr->cost[a];
+            float risk = labels.risk[l] - logf(reliability);
+
+            // Élagage par la destination puis par le sac du sommet atteint
+            int* bag = bags + (size_t)v * maxBagSize;
+            if (pareto_bag_dominates(&labels, bags + (size_t)dst * maxBagSize, bagSize[dst], time, cost, risk) ||
+                pareto_bag_dominates(&labels, bag, bagSize[v], time, cost, risk)) {
+                continue;
+            }
+
+            // Retirer du sac les étiquettes dominées par la nouvelle
+            int kept = 0;
+            for (int i = 0; i < bagSize[v]; i++) {
+                int old = bag[i];
+                if (time <= labels.time[old] && cost <= labels.cost[old] && risk <= labels.risk[old]) {
+                    labels.alive[old] = false;
+                } else {
+                    bag[kept++] = old;
+                }
+            }
+            bagSize[v] = kept;
+            if (kept == maxBagSize) {
+                *truncated = true;
+                continue;
+            }
+
+            int id = pareto_add_label(&labels, time, cost, risk, v, l);
+            bag[bagSize[v]++] = id;
+            if (heapSize == heapCapacity) {
+                heapCapacity *= 2;
+                heap = (int*)realloc(heap, heapCapacity * sizeof(int));
+            }
+            pareto_heap_push(heap, &heapSize, &labels, id);
+        }
+    }
+
+    // Construire les itinéraires à partir des étiquettes de la destination
+    int count = bagSize[dst];
+    *routes = (ParetoRoute*)malloc((count > 0 ? count : 1) * sizeof(ParetoRoute));
+    for (int r = 0; r < count; r++) {
+        int l = bags[(size_t)dst * maxBagSize + r];
+        ParetoRoute* route = &(*routes)[r];
+        route->time = labels.time[l];
+        route->cost = labels.cost[l];
+        route->reliability = expf(-labels.risk[l]);
+
+        route->length = 0;
+        for (int x = l; x >= 0; x = labels.pred[x]) {
+            route->length++;
+        }
+        route->path = (int*)malloc(route->length * sizeof(int));
+        int i = route->length;
+        for (int x = l; x >= 0; x = labels.pred[x]) {
+            route->path[--i] = labels.node[x];
+        }
+    }
+
+    free(labels.time);
+    free(labels.cost);
+    free(labels.risk);
+    free(labels.node);
+    free(labels.pred);
+    free(labels.alive);
+    free(bags);
+    free(bagSize);
+    free(heap);
+    return count;
+}
+
+// Fonction pour libérer les itinéraires retournés par pareto_routes
+void free_pareto_routes(ParetoRoute* routes, int count) {
+    for (int r = 0; r < count; r++) {
+        free(routes[r].path);
+    }
+    free(routes);
+}
+
+// Fonction pour trouver le sommet le plus proche non visité
+int find_nearest_neighbor(int current, bool* visited, const DistanceMatrix* dist, int V) {
+    int nearest = -1;
+    float min_distance = FLT_MAX;
+
+    for (int i = 0; i < V; i++) {
+        if (!visited[i] && DIST_AT(dist, current, i) < min_distance) {
+            min_distance = DIST_AT(dist, current, i);
+            nearest = i;
+        }
+    }
+
+    return nearest;
+}
+
+// Approche gloutonne pour résoudre le TSP (profil NULL : distances nominales)
+void greedy_tsp(Graph* graph, const WeightProfile* profile) {
+    int V = graph->V;
+
+    // Calculer la matrice des distances avec Floyd-Warshall
+    DistanceMatrix* dist = create_distance_matrix(V);
+    if (dist == NULL) {
+        return;
+    }
+    compute_distance_matrix(graph, profile, dist);
+
+    // Initialiser les variables
+    bool* visited = (bool*)calloc(V, sizeof(bool));
+    int* path = (int*)malloc(V * sizeof(int));
+    float total_cost = 0;
+
+    int current = 0; // Commencer par le sommet 0
+    visited[current] = true;
+    path[0] = current;
+
+    for (int i = 1; i < V; i++) {
+        int next = find_nearest_neighbor(current, visited, dist, V);
+        if (next == -1) {
+            printf("Erreur : Aucun sommet accessible.\n");
+            return;
+        }
+
+        total_cost += DIST_AT(dist, current, next);
+        visited[next] = true;
+        path[i] = next;
+        current = next;
+    }
+
+    // Retour au point de départ
+    total_cost += DIST_AT(dist, current, path[0]);
+
+    // Afficher le chemin et le coût total
+    printf("Chemin glouton : ");
+    for (int i = 0; i < V; i++) {
+        printf("%d -> ", path[i]);
+    }
+    printf("%d\n", path[0]);
+    printf("Coût total : %.2f\n", total_cost);
+
+    // Libérer la mémoire
+    free_distance_matrix(dist);
+    free(visited);
+    free(path);
+}
+
+// Structure pour représenter une livraison
 typedef struct {
     int cost;       // Coût de la livraison
     int time;       // Temps requis pour la livraison
@@ -826,266 +4344,1476 @@ typedef struct {
     int window;     // Fenêtre temporelle (jour où la livraison doit être effectuée)
 } Delivery;
 
-// Fonction pour planifier les livraisons
-int plan_deliveries(Delivery* deliveries, int n, int days, int capacity) {
-    // Table de programmation dynamique
-    int*** dp = (int***)malloc((days + 1) * sizeof(int**));
-    for (int d = 0; d <= days; d++) {
-        dp[d] = (int**)malloc((capacity + 1) * sizeof(int*));
-        for (int c = 0; c <= capacity; c++) {
-            dp[d][c] = (int*)malloc((n + 1) * sizeof(int));
-            for (int i = 0; i <= n; i++) {
-                dp[d][c][i] = INF; // Initialiser à l'infini
+// Fonction pour planifier les livraisons
+int plan_deliveries(Delivery* deliveries, int n, int days, int capacity) {
+    // Table de programmation dynamique
+    int*** dp = (int***)malloc((days + 1) * sizeof(int**));
+    for (int d = 0; d <= days; d++) {
+        dp[d] = (int**)malloc((capacity + 1) * sizeof(int*));
+        for (int c = 0; c <= capacity; c++) {
+            dp[d][c] = (int*)malloc((n + 1) * sizeof(int));
+            for (int i = 0; i <= n; i++) {
+                dp[d][c][i] = INF; // Initialiser à l'infini
+            }
+        }
+    }
+
+    // Initialisation : coût nul si aucune livraison n'est effectuée
+    for (int d = 0; d <= days; d++) {
+        for (int c = 0; c <= capacity; c++) {
+            dp[d][c][0] = 0;
+        }
+    }
+
+    // Remplir la table de programmation dynamique
+    for (int d = 1; d <= days; d++) {
+        for (int c = 0; c <= capacity; c++) {
+            for (int i = 1; i <= n; i++) {
+                // Ne pas effectuer la livraison i
+                dp[d][c][i] = dp[d][c][i - 1];
+
+                // Effectuer la livraison i si elle est dans la fenêtre temporelle et si la capacité le permet
+                if (deliveries[i - 1].window == d && deliveries[i - 1].time <= c) {
+                    int remaining_capacity = c - deliveries[i - 1].time;
+                    int cost_with_delivery = dp[d][remaining_capacity][i - 1] + deliveries[i - 1].cost;
+
+                    if (cost_with_delivery < dp[d][c][i]) {
+                        dp[d][c][i] = cost_with_delivery;
+                    }
+                }
+            }
+        }
+    }
+
+    // Trouver le coût minimal pour toutes les livraisons
+    int min_cost = INF;
+    for (int d = 1; d <= days; d++) {
+        for (int c = 0; c <= capacity; c++) {
+            if (dp[d][c][n] < min_cost) {
+                min_cost = dp[d][c][n];
+            }
+        }
+    }
+
+    // Libérer la mémoire
+    for (int d = 0; d <= days; d++) {
+        for (int c = 0; c <= capacity; c++) {
+            free(dp[d][c]);
+        }
+        free(dp[d]);
+    }
+    free(dp);
+
+    return min_cost;
+}
+
+#include <time.h>
+
+// Structure pour représenter un individu
+typedef struct {
+    int* path;       // Chemin (ordre des sommets)
+    float fitness;   // Coût total du chemin
+} Individual;
+
+// Fonction pour calculer le coût d'un chemin
+float calculate_fitness(int* path, int V, const DistanceMatrix* dist) {
+    float cost = 0;
+    for (int i = 0; i < V - 1; i++) {
+        cost += DIST_AT(dist, path[i], path[i + 1]);
+    }
+    cost += DIST_AT(dist, path[V - 1], path[0]); // Retour au point de départ
+    return cost;
+}
+
+// Fonction pour générer un individu aléatoire
+void generate_random_individual(Individual* individual, int V) {
+    for (int i = 0; i < V; i++) {
+        individual->path[i] = i;
+    }
+
+    // Mélanger les sommets pour créer un chemin aléatoire
+    for (int i = V - 1; i > 0; i--) {
+        int j = rand() % (i + 1);
+        int temp = individual->path[i];
+        individual->path[i] = individual->path[j];
+        individual->path[j] = temp;
+    }
+}
+
+// Fonction pour effectuer un croisement entre deux individus
+void crossover(Individual* parent1, Individual* parent2, Individual* child, int V) {
+    bool* visited = (bool*)calloc(V, sizeof(bool));
+
+    // Copier la première moitié du chemin du parent1
+    for (int i = 0; i < V / 2; i++) {
+        child->path[i] = parent1->path[i];
+        visited[parent1->path[i]] = true;
+    }
+
+    // Compléter avec les sommets restants du parent2
+    int index = V / 2;
+    for (int i = 0; i < V; i++) {
+        if (!visited[parent2->path[i]]) {
+            child->path[index++] = parent2->path[i];
+        }
+    }
+
+    free(visited);
+}
+
+// Fonction pour effectuer une mutation sur un individu
+void mutate(Individual* individual, int V) {
+    int i = rand() % V;
+    int j = rand() % V;
+
+    // Échanger deux sommets
+    int temp = individual->path[i];
+    individual->path[i] = individual->path[j];
+    individual->path[j] = temp;
+}
+
+// Algorithme génétique pour résoudre le TSP (profil NULL : distances nominales)
+void genetic_tsp(Graph* graph, const WeightProfile* profile, int population_size, int generations) {
+    int V = graph->V;
+
+    // Calculer la matrice des distances avec Floyd-Warshall
+    DistanceMatrix* dist = create_distance_matrix(V);
+    if (dist == NULL) {
+        return;
+    }
+    compute_distance_matrix(graph, profile, dist);
+
+    // Initialiser la population
+    Individual* population = (Individual*)malloc(population_size * sizeof(Individual));
+    for (int i = 0; i < population_size; i++) {
+        population[i].path = (int*)malloc(V * sizeof(int));
+        generate_random_individual(&population[i], V);
+        population[i].fitness = calculate_fitness(population[i].path, V, dist);
+    }
+
+    // Évolution sur plusieurs générations
+    for (int gen = 0; gen < generations; gen++) {
+        // Trier la population par fitness (coût croissant)
+        for (int i = 0; i < population_size - 1; i++) {
+            for (int j = i + 1; j < population_size; j++) {
+                if (population[i].fitness > population[j].fitness) {
+                    Individual temp = population[i];
+                    population[i] = population[j];
+                    population[j] = temp;
+                }
+            }
+        }
+
+        // Croisement et mutation pour créer la nouvelle génération
+        for (int i = population_size / 2; i < population_size; i++) {
+            crossover(&population[i - population_size / 2], &population[(i + 1) % (population_size / 2)], &population[i], V);
+            if (rand() % 100 < 10) { // 10% de chance de mutation
+                mutate(&population[i], V);
             }
+            population[i].fitness = calculate_fitness(population[i].path, V, dist);
         }
     }
 
-    // Initialisation : coût nul si aucune livraison n'est effectuée
-    for (int d = 0; d <= days; d++) {
-        for (int c = 0; c <= capacity; c++) {
-            dp[d][c][0] = 0;
+    // Afficher le meilleur chemin
+    printf("Chemin optimal (algorithme génétique) : ");
+    for (int i = 0; i < V; i++) {
+        printf("%d -> ", population[0].path[i]);
+    }
+    printf("%d\n", population[0].path[0]);
+    printf("Coût minimal : %.2f\n", population[0].fitness);
+
+    // Libérer la mémoire
+    for (int i = 0; i < population_size; i++) {
+        free(population[i].path);
+    }
+    free(population);
+    free_distance_matrix(dist);
+}
+
+// Fonction pour générer un graphe aléatoire
+Graph* generate_random_graph(int num_nodes, int num_edges) {
+    Graph* graph = create_graph(num_nodes);
+
+    srand(time(NULL)); // Initialiser le générateur de nombres aléatoires
+
+    for (int i = 0; i < num_edges; i++) {
+        int src = rand() % num_nodes;
+        int dest = rand() % num_nodes;
+
+        // Éviter les boucles et les doublons
+        if (src == dest) continue;
+
+        EdgeAttr attr;
+        attr.distance = (float)(rand() % 100 + 1); // Distance entre 1 et 100 km
+        attr.baseTime = (float)(rand() % 120 + 10); // Temps entre 10 et 120 minutes
+        attr.cost = (float)(rand() % 1000 + 100); // Coût entre 100 et 1000 unités
+        attr.roadType = rand() % 2; // Type de route : 0 ou 1
+        attr.reliability = (float)(rand() % 100) / 100.0; // Fiabilité entre 0.0 et 1.0
+        attr.restrictions = rand() % 4; // Restrictions codées en bits
+        set_default_time_variation(&attr);
+
+        if (!add_edge(graph, src, dest, attr)) {
+            break; // mémoire insuffisante : le graphe garde les arêtes déjà ajoutées
         }
     }
 
-    // Remplir la table de programmation dynamique
-    for (int d = 1; d <= days; d++) {
-        for (int c = 0; c <= capacity; c++) {
-            for (int i = 1; i <= n; i++) {
-                // Ne pas effectuer la livraison i
-                dp[d][c][i] = dp[d][c][i - 1];
+    return graph;
+}
 
-                // Effectuer la livraison i si elle est dans la fenêtre temporelle et si la capacité le permet
-                if (deliveries[i - 1].window == d && deliveries[i - 1].time <= c) {
-                    int remaining_capacity = c - deliveries[i - 1].time;
-                    int cost_with_delivery = dp[d][remaining_capacity][i - 1] + deliveries[i - 1].cost;
+// Fonction pour générer et sauvegarder un graphe dans un fichier JSON
+void generate_and_save_graph_to_json(const char* filename, int num_nodes, int num_edges) {
+    Graph* graph = generate_random_graph(num_nodes, num_edges);
 
-                    if (cost_with_delivery < dp[d][c][i]) {
-                        dp[d][c][i] = cost_with_delivery;
+    // Sauvegarder le graphe dans un fichier JSON
+    save_graph_to_json(graph, filename);
+
+    printf("Graphe généré et sauvegardé dans le fichier '%s'.\n", filename);
+
+    free_graph(graph);
+}
+
+// Fonction pour générer des jeux de données de test et les sauvegarder dans des fichiers JSON
+void generate_test_datasets_to_json() {
+    printf("Génération des jeux de données et sauvegarde dans des fichiers JSON...\n");
+
+    // Petit réseau (10-20 nœuds)
+    printf("\nPetit réseau (10-20 nœuds) :\n");
+    generate_and_save_graph_to_json("small_graph.json", 15, 30);
+
+    // Réseau moyen (100-150 nœuds)
+    printf("\nRéseau moyen (100-150 nœuds) :\n");
+    generate_and_save_graph_to_json("medium_graph.json", 120, 300);
+
+    // Grand réseau (200+ nœuds)
+    printf("\nGrand réseau (200+ nœuds) :\n");
+    generate_and_save_graph_to_json("large_graph.json", 250, 1000);
+}
+
+// Fonction pour appliquer un scénario au graphe
+void apply_scenario(Graph* graph, const char* scenario) {
+    if (strcmp(scenario, "Jour normal d’activité") == 0) {
+        adjust_graph_attributes(graph, 12); // Exemple : ajuster pour midi
+    } else if (strcmp(scenario, "Période de pointe") == 0) {
+        adjust_graph_attributes(graph, 8); // Exemple : ajuster pour 8h
+    } else if (strcmp(scenario, "Situation de crise") == 0) {
+        for (int v = 0; v < graph->V; v++) {
+            AdjListNode* current = graph->array[v].head;
+            while (current != NULL) {
+                current->attr.reliability *= 0.5; // Réduire la fiabilité de moitié
+                current = current->next;
+            }
+        }
+    }
+}
+
+#define SCENARIO_NAME_MAX 64
+
+// Modification d'une arête particulière dans un scénario
+typedef struct EdgeChange {
+    int src;
+    int dest;
+    float timeMultiplier;         // multiplicateur du temps nominal
+    float costMultiplier;         // multiplicateur du coût
+    float reliability;            // nouvelle fiabilité (< 0 : inchangée)
+} EdgeChange;
+
+// Scénario « et si » appliqué à un graphe de base sans le modifier
+typedef struct Scenario {
+    char name[SCENARIO_NAME_MAX];
+    int hour;                     // heure de référence du scénario
+    float distanceMultiplier;     // multiplicateurs appliqués à toutes les arêtes
+    float timeMultiplier;
+    float costMultiplier;
+    float reliabilityMultiplier;
+    int closedEdgeCount;
+    int* closedEdges;             // paires (source, destination) fermées
+    int closedNodeCount;
+    int* closedNodes;             // sommets fermés (toutes leurs arêtes)
+    int edgeChangeCount;
+    EdgeChange* edgeChanges;
+} Scenario;
+
+// Requête d'itinéraire évaluée pour chaque scénario
+typedef struct RouteQuery {
+    int src;
+    int dst;
+} RouteQuery;
+
+// Fonction pour charger des scénarios depuis un fichier JSON
+// Format : {"scenarios": [{"name": "...", "hour": 8, "timeMultiplier": 1.5, "costMultiplier": 1.2,
+//           "distanceMultiplier": 1, "reliabilityMultiplier": 0.5, "closedEdges": [[0, 1]],
+//           "closedNodes": [3], "edgeChanges": [{"source": 0, "destination": 2,
+//           "timeMultiplier": 2, "costMultiplier": 1, "reliability": 0.3}]}]}
+// Les champs absents prennent une valeur neutre. Retourne NULL en cas d'erreur.
+Scenario* load_scenarios_from_json(const char* filename, int* count) {
+    FILE* file = fopen(filename, "r");
+    if (file == NULL) {
+        fprintf(stderr, "Erreur : Impossible d'ouvrir le fichier de scénarios.\n");
+        return NULL;
+    }
+
+    fseek(file, 0, SEEK_END);
+    long length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    char* data = (char*)malloc(length + 1);
+    length = (long)fread(data, 1, length, file);
+    fclose(file);
+    data[length] = '\0';
+
+    cJSON* root = cJSON_Parse(data);
+    free(data);
+
+    cJSON* scenarios_json = cJSON_GetObjectItem(root, "scenarios");
+    if (!cJSON_IsArray(scenarios_json)) {
+        fprintf(stderr, "Erreur : Le fichier ne contient pas un tableau 'scenarios'.\n");
+        cJSON_Delete(root);
+        return NULL;
+    }
+
+    *count = cJSON_GetArraySize(scenarios_json);
+    Scenario* scenarios = (Scenario*)calloc(*count > 0 ? *count : 1, sizeof(Scenario));
+
+    int i = 0;
+    cJSON* scenario_json;
+    cJSON_ArrayForEach(scenario_json, scenarios_json) {
+        Scenario* scenario = &scenarios[i++];
+        const char* name = cJSON_GetStringValue(cJSON_GetObjectItem(scenario_json, "name"));
+        snprintf(scenario->name, SCENARIO_NAME_MAX, "%s", name ? name : "");
+        scenario->hour = (int)get_json_number(scenario_json, "hour", 12);
+        scenario->distanceMultiplier = get_json_number(scenario_json, "distanceMultiplier", 1);
+        scenario->timeMultiplier = get_json_number(scenario_json, "timeMultiplier", 1);
+        scenario->costMultiplier = get_json_number(scenario_json, "costMultiplier", 1);
+        scenario->reliabilityMultiplier = get_json_number(scenario_json, "reliabilityMultiplier", 1);
+
+        cJSON* closedEdges = cJSON_GetObjectItem(scenario_json, "closedEdges");
+        scenario->closedEdgeCount = cJSON_GetArraySize(closedEdges);
+        scenario->closedEdges = (int*)malloc((2 * scenario->closedEdgeCount + 1) * sizeof(int));
+        for (int e = 0; e < scenario->closedEdgeCount; e++) {
+            cJSON* pair = cJSON_GetArrayItem(closedEdges, e);
+            scenario->closedEdges[2 * e] = (int)cJSON_GetNumberValue(cJSON_GetArrayItem(pair, 0));
+            scenario->closedEdges[2 * e + 1] = (int)cJSON_GetNumberValue(cJSON_GetArrayItem(pair, 1));
+        }
+
+        cJSON* closedNodes = cJSON_GetObjectItem(scenario_json, "closedNodes");
+        scenario->closedNodeCount = cJSON_GetArraySize(closedNodes);
+        scenario->closedNodes = (int*)malloc((scenario->closedNodeCount + 1) * sizeof(int));
+        for (int n = 0; n < scenario->closedNodeCount; n++) {
+            scenario->closedNodes[n] = (int)cJSON_GetNumberValue(cJSON_GetArrayItem(closedNodes, n));
+        }
+
+        cJSON* edgeChanges = cJSON_GetObjectItem(scenario_json, "edgeChanges");
+        scenario->edgeChangeCount = cJSON_GetArraySize(edgeChanges);
+        scenario->edgeChanges = (EdgeChange*)malloc((scenario->edgeChangeCount + 1) * sizeof(EdgeChange));
+        for (int c = 0; c < scenario->edgeChangeCount; c++) {
+            cJSON* change_json = cJSON_GetArrayItem(edgeChanges, c);
+            EdgeChange* change = &scenario->edgeChanges[c];
+            change->src = (int)get_json_number(change_json, "source", -1);
+            change->dest = (int)get_json_number(change_json, "destination", -1);
+            change->timeMultiplier = get_json_number(change_json, "timeMultiplier", 1);
+            change->costMultiplier = get_json_number(change_json, "costMultiplier", 1);
+            change->reliability = get_json_number(change_json, "reliability", -1);
+        }
+    }
+
+    cJSON_Delete(root);
+    return scenarios;
+}
+
+// Fonction pour libérer des scénarios
+void free_scenarios(Scenario* scenarios, int count) {
+    for (int i = 0; i < count; i++) {
+        free(scenarios[i].closedEdges);
+        free(scenarios[i].closedNodes);
+        free(scenarios[i].edgeChanges);
+    }
+    free(scenarios);
+}
+
+// Tampons propres à un thread pour évaluer un scénario sur le graphe de base
+typedef struct ScenarioBuffers {
+    float* distance;
+    float* baseTime;
+    float* cost;
+    float* reliability;
+    float* weights;
+    bool* closedNode;
+    DijkstraWorkspace* ws;
+} ScenarioBuffers;
+
+// Fonction pour appliquer une modification à tous les arcs u -> v d'un graphe CSR
+void apply_edge_change(const CSRGraph* csr, ScenarioBuffers* buffers, int u, int v, const EdgeChange* change) {
+    if (u < 0 || u >= csr->V) {
+        return;
+    }
+    for (int a = csr->offsets[u]; a < csr->offsets[u + 1]; a++) {
+        if (csr->targets[a] != v) {
+            continue;
+        }
+        if (change == NULL) {
+            buffers->weights[a] = FORBIDDEN_WEIGHT; // arête fermée
+        } else {
+            buffers->baseTime[a] *= change->timeMultiplier;
+            buffers->cost[a] *= change->costMultiplier;
+            if (change->reliability >= 0) {
+                buffers->reliability[a] = change->reliability;
+            }
+        }
+    }
+}
+
+// Fonction pour calculer les poids d'un scénario dans les tampons d'un thread
+// Le graphe de base n'est jamais modifié : une vue CSR partage sa structure et pointe
+// vers les colonnes modifiées du thread.
+void compile_scenario_weights(const CSRGraph* csr, const Scenario* scenario,
+                              const WeightProfile* profile, ScenarioBuffers* buffers) {
+    int A = csr->A;
+    for (int a = 0; a < A; a++) {
+        float reliability = csr->reliability[a] * scenario->reliabilityMultiplier;
+        buffers->distance[a] = csr->distance[a] * scenario->distanceMultiplier;
+        buffers->baseTime[a] = csr->baseTime[a] * scenario->timeMultiplier;
+        buffers->cost[a] = csr->cost[a] * scenario->costMultiplier;
+        buffers->reliability[a] = (reliability < 1.0f) ? reliability : 1.0f;
+    }
+    for (int c = 0; c < scenario->edgeChangeCount; c++) {
+        const EdgeChange* change = &scenario->edgeChanges[c];
+        apply_edge_change(csr, buffers, change->src, change->dest, change);
+        if (change->src != change->dest) {
+            apply_edge_change(csr, buffers, change->dest, change->src, change);
+        }
+    }
+
+    CSRGraph view = *csr;
+    view.distance = buffers->distance;
+    view.baseTime = buffers->baseTime;
+    view.cost = buffers->cost;
+    view.reliability = buffers->reliability;
+    WeightProfile scenarioProfile = *profile;
+    scenarioProfile.hour = scenario->hour;
+    compile_weight_profile(&view, &scenarioProfile, buffers->weights);
+
+    // Fermetures : arêtes désignées, puis toutes les arêtes des sommets fermés
+    for (int e = 0; e < scenario->closedEdgeCount; e++) {
+        int u = scenario->closedEdges[2 * e];
+        int v = scenario->closedEdges[2 * e + 1];
+        apply_edge_change(csr, buffers, u, v, NULL);
+        apply_edge_change(csr, buffers, v, u, NULL);
+    }
+    if (scenario->closedNodeCount > 0) {
+        memset(buffers->closedNode, 0, csr->V * sizeof(bool));
+        for (int n = 0; n < scenario->closedNodeCount; n++) {
+            if (scenario->closedNodes[n] >= 0 && scenario->closedNodes[n] < csr->V) {
+                buffers->closedNode[scenario->closedNodes[n]] = true;
+            }
+        }
+        for (int u = 0; u < csr->V; u++) {
+            for (int a = csr->offsets[u]; a < csr->offsets[u + 1]; a++) {
+                if (buffers->closedNode[u] || buffers->closedNode[csr->targets[a]]) {
+                    buffers->weights[a] = FORBIDDEN_WEIGHT;
+                }
+            }
+        }
+    }
+}
+
+// Fonction pour évaluer N scénarios × M requêtes en parallèle sur un graphe de base partagé
+// results[s * queryCount + q] reçoit le coût du meilleur itinéraire de la requête q dans le
+// scénario s (FLT_MAX si inaccessible). Le profil (NULL : le plus rapide) fixe les critères ;
+// son heure est remplacée par celle de chaque scénario. Les scénarios sont répartis entre les
+// threads, chacun disposant de ses propres tampons : le CSR de base reste en lecture seule.
+void run_scenario_batch(const CSRGraph* csr, const Scenario* scenarios, int scenarioCount,
+                        const RouteQuery* queries, int queryCount, const WeightProfile* profile,
+                        float* results) {
+    WeightProfile fastest = fastest_weight_profile(12);
+    if (profile == NULL) {
+        profile = &fastest;
+    }
+
+    #pragma omp parallel
+    {
+        ScenarioBuffers buffers;
+        buffers.distance = (float*)malloc(csr->A * sizeof(float));
+        buffers.baseTime = (float*)malloc(csr->A * sizeof(float));
+        buffers.cost = (float*)malloc(csr->A * sizeof(float));
+        buffers.reliability = (float*)malloc(csr->A * sizeof(float));
+        buffers.weights = (float*)malloc(csr->A * sizeof(float));
+        buffers.closedNode = (bool*)malloc(csr->V * sizeof(bool));
+        buffers.ws = create_dijkstra_workspace(csr->V);
+
+        #pragma omp for schedule(dynamic, 1)
+        for (int s = 0; s < scenarioCount; s++) {
+            compile_scenario_weights(csr, &scenarios[s], profile, &buffers);
+            for (int q = 0; q < queryCount; q++) {
+                const RouteQuery* query = &queries[q];
+                float cost = FLT_MAX;
+                if (query->src >= 0 && query->src < csr->V && query->dst >= 0 && query->dst < csr->V) {
+                    cost = dijkstra_csr(csr, buffers.weights, query->src, query->dst, buffers.ws);
+                }
+                results[(size_t)s * queryCount + q] = cost;
+            }
+        }
+
+        free(buffers.distance);
+        free(buffers.baseTime);
+        free(buffers.cost);
+        free(buffers.reliability);
+        free(buffers.weights);
+        free(buffers.closedNode);
+        free_dijkstra_workspace(buffers.ws);
+    }
+}
+
+// Fonction pour afficher les résultats d'un lot de scénarios
+void print_scenario_batch_results(const Scenario* scenarios, int scenarioCount,
+                                  const RouteQuery* queries, int queryCount, const float* results) {
+    for (int s = 0; s < scenarioCount; s++) {
+        printf("Scénario : %s (%dh)\n", scenarios[s].name, scenarios[s].hour);
+        for (int q = 0; q < queryCount; q++) {
+            float cost = results[(size_t)s * queryCount + q];
+            if (cost == FLT_MAX) {
+                printf("  %d -> %d : inaccessible\n", queries[q].src, queries[q].dst);
+            } else {
+                printf("  %d -> %d : %.2f\n", queries[q].src, queries[q].dst, cost);
+            }
+        }
+    }
+}
+
+#define MONTE_CARLO_BLOCK 64 // Échantillons par bloc (réduction indépendante du nombre de threads)
+
+// Estimation de fiabilité d'une paire origine-destination
+typedef struct ReliabilityEstimate {
+    float failureProbability;     // proportion des tirages où la destination est inaccessible
+    float expectedTime;           // temps moyen quand la destination est accessible (FLT_MAX sinon)
+    float nominalTime;            // temps sans aucune panne (FLT_MAX si inaccessible)
+    float expectedDelay;          // expectedTime - nominalTime
+} ReliabilityEstimate;
+
+// Générateur pseudo-aléatoire à compteur : même (graine, tirage, arête) => même valeur
+// Aucun état partagé : les tirages peuvent être faits dans n'importe quel ordre, sur n'importe quel thread.
+double counter_random(uint64_t seed, uint64_t sample, uint64_t edge) {
+    uint64_t x = seed ^ (sample * 0x9E3779B97F4A7C15ULL) ^ (edge * 0xC2B2AE3D27D4EB4FULL);
+    // Mélange splitmix64
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    x ^= x >> 31;
+    return (x >> 11) * (1.0 / 9007199254740992.0); // 53 bits -> [0, 1)
+}
+
+// Fonction pour évaluer tous les couples d'un tirage avec les poids donnés
+// order liste pairCount paires triées par origine ; celles partageant la même origine sont
+// servies par une seule recherche. Une paire hors limites est marquée inaccessible (FLT_MAX).
+void evaluate_route_pairs(const CSRGraph* csr, const float* weights, const RouteQuery* pairs, int pairCount,
+                          const int* order, DijkstraWorkspace* ws, float* times) {
+    for (int i = 0; i < pairCount; ) {
+        int src = pairs[order[i]].src;
+        int j = i;
+        while (j < pairCount && pairs[order[j]].src == src) {
+            j++;
+        }
+        if (src < 0 || src >= csr->V) {
+            for (int k = i; k < j; k++) {
+                times[order[k]] = FLT_MAX;
+            }
+            i = j;
+            continue;
+        }
+        // Une seule destination : arrêt anticipé ; sinon arbre complet
+        int dst = (j - i == 1) ? pairs[order[i]].dst : -1;
+        if (dst >= csr->V) {
+            dst = -1;
+        }
+        dijkstra_csr(csr, weights, src, dst, ws);
+        for (int k = i; k < j; k++) {
+            int target = pairs[order[k]].dst;
+            times[order[k]] = (target >= 0 && target < csr->V) ? ws->dist[target] : FLT_MAX;
+        }
+        i = j;
+    }
+}
+
+// Fonction pour simuler par Monte Carlo les pannes d'arêtes selon leur fiabilité
+// À chaque tirage, chaque arête est coupée avec la probabilité 1 - fiabilité (les deux sens
+// ensemble), puis les plus courts chemins des paires sont recalculés avec les poids donnés
+// (NULL : temps nominal). Les tirages sont traités en parallèle par blocs ; le résultat ne
+// dépend que de la graine, pas du nombre de threads. Une paire dont une extrémité est hors
+// limites n'est jamais évaluée : elle est inaccessible (temps FLT_MAX, probabilité d'échec 1).
+void simulate_edge_failures(const CSRGraph* csr, const float* weights, const RouteQuery* pairs, int pairCount,
+                            int samples, uint64_t seed, ReliabilityEstimate* results) {
+    if (weights == NULL) {
+        weights = csr->baseTime;
+    }
+
+    // Trier les paires valides par origine (tri par insertion sur les indices, peu de paires)
+    int* order = (int*)malloc((pairCount + 1) * sizeof(int));
+    int validCount = 0;
+    for (int i = 0; i < pairCount; i++) {
+        if (pairs[i].src < 0 || pairs[i].src >= csr->V || pairs[i].dst < 0 || pairs[i].dst >= csr->V) {
+            fprintf(stderr, "Erreur : Paire %d -> %d hors limites (%d sommets), ignorée.\n",
+                    pairs[i].src, pairs[i].dst, csr->V);
+            continue;
+        }
+        int j = validCount++;
+        while (j > 0 && pairs[order[j - 1]].src > pairs[i].src) {
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = i;
+    }
+
+    // Temps sans panne (les paires ignorées restent inaccessibles)
+    float* nominal = (float*)malloc((pairCount + 1) * sizeof(float));
+    for (int p = 0; p < pairCount; p++) {
+        nominal[p] = FLT_MAX;
+    }
+    DijkstraWorkspace* ws = create_dijkstra_workspace(csr->V);
+    evaluate_route_pairs(csr, weights, pairs, validCount, order, ws, nominal);
+    free_dijkstra_workspace(ws);
+
+    int blockCount = (samples + MONTE_CARLO_BLOCK - 1) / MONTE_CARLO_BLOCK;
+    double* blockSum = (double*)calloc((size_t)blockCount * pairCount + 1, sizeof(double));
+    int* blockReached = (int*)calloc((size_t)blockCount * pairCount + 1, sizeof(int));
+
+    #pragma omp parallel
+    {
+        float* sampleWeights = (float*)malloc(csr->A * sizeof(float));
+        float* times = (float*)malloc((pairCount + 1) * sizeof(float));
+        DijkstraWorkspace* threadWs = create_dijkstra_workspace(csr->V);
+
+        #pragma omp for schedule(dynamic, 1)
+        for (int b = 0; b < blockCount; b++) {
+            int end = (b + 1) * MONTE_CARLO_BLOCK < samples ? (b + 1) * MONTE_CARLO_BLOCK : samples;
+            for (int sample = b * MONTE_CARLO_BLOCK; sample < end; sample++) {
+                // Tirer l'état de chaque arête (identique pour ses deux arcs)
+                for (int a = 0; a < csr->A; a++) {
+                    bool failed = counter_random(seed, sample, csr->edge_ids[a]) >= csr->reliability[a];
+                    sampleWeights[a] = failed ? FORBIDDEN_WEIGHT : weights[a];
+                }
+
+                evaluate_route_pairs(csr, sampleWeights, pairs, validCount, order, threadWs, times);
+                for (int i = 0; i < validCount; i++) {
+                    int p = order[i];
+                    if (times[p] < FLT_MAX) {
+                        blockSum[(size_t)b * pairCount + p] += times[p];
+                        blockReached[(size_t)b * pairCount + p]++;
                     }
                 }
             }
         }
+
+        free(sampleWeights);
+        free(times);
+        free_dijkstra_workspace(threadWs);
     }
 
-    // Trouver le coût minimal pour toutes les livraisons
-    int min_cost = INF;
-    for (int d = 1; d <= days; d++) {
-        for (int c = 0; c <= capacity; c++) {
-            if (dp[d][c][n] < min_cost) {
-                min_cost = dp[d][c][n];
+    // Réduction dans l'ordre des blocs (résultat reproductible)
+    for (int p = 0; p < pairCount; p++) {
+        double sum = 0;
+        long reached = 0;
+        for (int b = 0; b < blockCount; b++) {
+            sum += blockSum[(size_t)b * pairCount + p];
+            reached += blockReached[(size_t)b * pairCount + p];
+        }
+        ReliabilityEstimate* estimate = &results[p];
+        estimate->failureProbability = (samples > 0) ? 1.0f - (float)reached / samples : 0.0f;
+        estimate->expectedTime = (reached > 0) ? (float)(sum / reached) : FLT_MAX;
+        estimate->nominalTime = nominal[p];
+        estimate->expectedDelay = (reached > 0 && nominal[p] < FLT_MAX) ? estimate->expectedTime - nominal[p] : FLT_MAX;
+    }
+
+    free(order);
+    free(nominal);
+    free(blockSum);
+    free(blockReached);
+}
+
+#define BETWEENNESS_DELTA 0.05 // risque accepté pour la borne d'erreur de l'approximation (confiance 95 %)
+
+// Centralité d'intermédiarité des sommets et des arêtes
+typedef struct Betweenness {
+    double* node;                 // centralité de chaque sommet (V)
+    double* edge;                 // centralité de chaque arête, indexée par edge_id du CSR (E)
+    int sources;                  // sources utilisées (V en mode exact)
+    double errorBound;            // écart maximal d'un score de sommet avec probabilité 1 - BETWEENNESS_DELTA
+                                  // (0 en mode exact)
+} Betweenness;
+
+// Fonction pour accumuler les dépendances des plus courts chemins issus d'une source (Brandes)
+// Dijkstra compte les plus courts chemins (sigma) puis les sommets sont repris dans l'ordre
+// inverse de leur extraction pour propager les dépendances (delta) vers leurs prédécesseurs.
+// Les arcs interdits, filtrés ou de poids nul sont ignorés. sigma, delta et order sont des
+// tableaux de V valeurs propres au thread ; delta doit être nul à l'entrée et l'est à la sortie.
+void brandes_accumulate(const CSRGraph* csr, const float* weights, int src, DijkstraWorkspace* ws,
+                        double* sigma, double* delta, int* order, double* nodeScore, double* edgeScore) {
+    if (!reserve_dijkstra_workspace(ws, csr->V)) {
+        return;
+    }
+    reset_dijkstra_workspace(ws);
+    MinHeap* heap = ws->heap;
+    int settled = 0;
+
+    ws->dist[src] = 0;
+    ws->touched[ws->touchedCount++] = src;
+    sigma[src] = 1;
+    heap_push_or_decrease(heap, src, 0);
+
+    while (heap->size > 0) {
+        int u = heap_pop(heap);
+        order[settled++] = u;
+
+        float d = ws->dist[u];
+        for (int a = csr->offsets[u]; a < csr->offsets[u + 1]; a++) {
+            if (!CSR_ARC_ALLOWED(csr, a) || weights[a] <= 0 || weights[a] >= FORBIDDEN_WEIGHT) {
+                continue;
+            }
+            int v = csr->targets[a];
+            float candidate = d + weights[a];
+            if (candidate < ws->dist[v]) {
+                if (ws->dist[v] == FLT_MAX) {
+                    ws->touched[ws->touchedCount++] = v;
+                }
+                ws->dist[v] = candidate;
+                sigma[v] = sigma[u];
+                heap_push_or_decrease(heap, v, candidate);
+            } else if (candidate == ws->dist[v]) {
+                sigma[v] += sigma[u];
             }
         }
     }
 
-    // Libérer la mémoire
-    for (int d = 0; d <= days; d++) {
-        for (int c = 0; c <= capacity; c++) {
-            free(dp[d][c]);
+    // Propagation des dépendances : w est successeur de v si dist[v] + poids == dist[w]
+    for (int i = settled - 1; i >= 0; i--) {
+        int v = order[i];
+        float d = ws->dist[v];
+        for (int a = csr->offsets[v]; a < csr->offsets[v + 1]; a++) {
+            if (!CSR_ARC_ALLOWED(csr, a) || weights[a] <= 0 || weights[a] >= FORBIDDEN_WEIGHT) {
+                continue;
+            }
+            int w = csr->targets[a];
+            if (ws->dist[w] < FLT_MAX && d + weights[a] == ws->dist[w]) {
+                double c = sigma[v] / sigma[w] * (1.0 + delta[w]);
+                delta[v] += c;
+                edgeScore[csr->edge_ids[a]] += c;
+            }
+        }
+        if (v != src) {
+            nodeScore[v] += delta[v];
         }
-        free(dp[d]);
     }
-    free(dp);
 
-    return min_cost;
+    for (int i = 0; i < settled; i++) {
+        delta[order[i]] = 0;
+    }
 }
 
-#include <time.h>
+// Fonction pour calculer la centralité d'intermédiarité des sommets et des arêtes (Brandes)
+// Les plus courts chemins suivent les poids donnés (NULL : temps nominal). Avec samples <= 0 ou
+// samples >= V, toutes les sources sont utilisées (résultat exact) ; sinon samples sources
+// distinctes sont tirées selon la graine et les scores sont extrapolés par V / samples.
+// La borne d'erreur (inégalité de Hoeffding) vaut V (V - 2) / 2 * sqrt(ln(2 / delta) / (2 samples)).
+// Chaque paire non orientée est comptée une fois. Les sources sont réparties entre les threads,
+// chacun accumulant dans ses propres tableaux ; ceux-ci sont sommés dans l'ordre des threads.
+Betweenness* compute_betweenness(const CSRGraph* csr, const float* weights, int samples, uint64_t seed) {
+    if (weights == NULL) {
+        weights = csr->baseTime;
+    }
+    int V = csr->V;
+    int E = csr->E;
+    Betweenness* bc = (Betweenness*)malloc(sizeof(Betweenness));
+    bc->node = (double*)calloc(V > 0 ? V : 1, sizeof(double));
+    bc->edge = (double*)calloc(E > 0 ? E : 1, sizeof(double));
+
+    // Sources : toutes, ou un tirage sans remise (mélange de Fisher-Yates partiel)
+    int* sources = (int*)malloc((V > 0 ? V : 1) * sizeof(int));
+    for (int v = 0; v < V; v++) {
+        sources[v] = v;
+    }
+    int k = V;
+    if (samples > 0 && samples < V) {
+        k = samples;
+        for (int i = 0; i < k; i++) {
+            int j = i + (int)(counter_random(seed, i, 0) * (V - i));
+            int tmp = sources[i];
+            sources[i] = sources[j];
+            sources[j] = tmp;
+        }
+    }
+    bc->sources = k;
+    bc->errorBound = (k < V) ? (double)V * (V - 2) / 2.0 * sqrt(log(2.0 / BETWEENNESS_DELTA) / (2.0 * k)) : 0.0;
+
+    int threadCount = 1;
+#ifdef _OPENMP
+    threadCount = omp_get_max_threads();
+#endif
+    double** nodeLocal = (double**)calloc(threadCount, sizeof(double*));
+    double** edgeLocal = (double**)calloc(threadCount, sizeof(double*));
+
+    #pragma omp parallel num_threads(threadCount)
+    {
+        int t = 0;
+#ifdef _OPENMP
+        t = omp_get_thread_num();
+#endif
+        nodeLocal[t] = (double*)calloc(V > 0 ? V : 1, sizeof(double));
+        edgeLocal[t] = (double*)calloc(E > 0 ? E : 1, sizeof(double));
+        DijkstraWorkspace* ws = create_dijkstra_workspace(V);
+        double* sigma = (double*)malloc((V > 0 ? V : 1) * sizeof(double));
+        double* delta = (double*)calloc(V > 0 ? V : 1, sizeof(double));
+        int* order = (int*)malloc((V > 0 ? V : 1) * sizeof(int));
+
+        #pragma omp for schedule(static, 1)
+        for (int i = 0; i < k; i++) {
+            brandes_accumulate(csr, weights, sources[i], ws, sigma, delta, order, nodeLocal[t], edgeLocal[t]);
+        }
 
-// Structure pour représenter un individu
-typedef struct {
-    int* path;       // Chemin (ordre des sommets)
-    float fitness;   // Coût total du chemin
-} Individual;
+        free_dijkstra_workspace(ws);
+        free(sigma);
+        free(delta);
+        free(order);
+    }
 
-// Fonction pour calculer le coût d'un chemin
-float calculate_fitness(int* path, int V, float** dist) {
-    float cost = 0;
-    for (int i = 0; i < V - 1; i++) {
-        cost += dist[path[i]][path[i + 1]];
+    // Réduction dans l'ordre des threads, puis mise à l'échelle (paires comptées dans les deux sens)
+    double scale = (double)V / k / 2.0;
+    for (int t = 0; t < threadCount; t++) {
+        if (nodeLocal[t] == NULL) {
+            continue;
+        }
+        for (int v = 0; v < V; v++) {
+            bc->node[v] += nodeLocal[t][v];
+        }
+        for (int e = 0; e < E; e++) {
+            bc->edge[e] += edgeLocal[t][e];
+        }
+        free(nodeLocal[t]);
+        free(edgeLocal[t]);
     }
-    cost += dist[path[V - 1]][path[0]]; // Retour au point de départ
-    return cost;
+    for (int v = 0; v < V; v++) {
+        bc->node[v] *= scale;
+    }
+    for (int e = 0; e < E; e++) {
+        bc->edge[e] *= scale;
+    }
+
+    free(nodeLocal);
+    free(edgeLocal);
+    free(sources);
+    return bc;
 }
 
-// Fonction pour générer un individu aléatoire
-void generate_random_individual(Individual* individual, int V) {
-    for (int i = 0; i < V; i++) {
-        individual->path[i] = i;
-    }
+// Fonction pour libérer un résultat de centralité
+void free_betweenness(Betweenness* bc) {
+    free(bc->node);
+    free(bc->edge);
+    free(bc);
+}
 
-    // Mélanger les sommets pour créer un chemin aléatoire
-    for (int i = V - 1; i > 0; i--) {
-        int j = rand() % (i + 1);
-        int temp = individual->path[i];
-        individual->path[i] = individual->path[j];
-        individual->path[j] = temp;
+#define MAXFLOW_UNLIMITED ((int64_t)1 << 50) // capacité d'un sommet sans limite déclarée
+#define FLOW_SOURCE 1                        // rôle d'un nœud du réseau de flot : source
+#define FLOW_SINK 2                          // rôle d'un nœud du réseau de flot : puits
+
+// Fonction pour obtenir la capacité journalière d'une route selon son type (unités de fret)
+int road_capacity(int roadType) {
+    switch (roadType) {
+        case 0:
+            return 1000; // asphalte
+        case 1:
+            return 400;  // latérite
+        case 2:
+            return 200;  // piste
+        default:
+            return 100;
     }
 }
 
-// Fonction pour effectuer un croisement entre deux individus
-void crossover(Individual* parent1, Individual* parent2, Individual* child, int V) {
-    bool* visited = (bool*)calloc(V, sizeof(bool));
+// Réseau de flot résiduel construit à partir d'un graphe CSR
+// Chaque sommet v est dédoublé en une entrée 2v et une sortie 2v + 1, reliées par un arc de la
+// capacité du sommet. Chaque arc u -> v du CSR devient un arc sortie(u) -> entrée(v) de la
+// capacité de la route. Tout arc a un arc inverse (rev) de capacité nulle dans le réseau initial.
+typedef struct FlowNetwork {
+    int N;                        // nombre de nœuds (2 V)
+    int M;                        // nombre d'arcs, arcs inverses compris
+    int* first;                   // début des arcs de chaque nœud (N + 1)
+    int* to;                      // nœud destination de chaque arc
+    int* rev;                     // indice de l'arc inverse
+    int* edge;                    // arête du CSR portée par l'arc (-1 : arc interne ou inverse)
+    int64_t* capacity;            // capacité initiale de chaque arc
+    int64_t* residual;            // capacité résiduelle (modifiée par max_flow et min_cost_flow)
+    float* cost;                  // coût unitaire de chaque arc (opposé pour un arc inverse)
+
+    // Espace de travail du push-relabel
+    int* label;
+    int* current;                 // prochain arc à examiner de chaque nœud
+    int64_t* excess;
+    int* count;                   // nombre de nœuds de chaque étiquette (2 N + 1)
+    int* queue;                   // file FIFO des nœuds actifs (N)
+    bool* active;
+    unsigned char* role;          // FLOW_SOURCE, FLOW_SINK ou 0
+
+    // Espace de travail des plus courts chemins successifs (min_cost_flow)
+    MinHeap* heap;
+    float* potential;             // potentiel de chaque nœud (coûts réduits positifs)
+    float* dist;                  // distance réduite depuis les nœuds excédentaires (FLT_MAX : non atteint)
+    int* parentArc;               // arc menant à chaque nœud dans l'arbre des plus courts chemins
+} FlowNetwork;
+
+// Fonction pour ajouter un arc et son inverse au réseau (fill : prochain emplacement de chaque nœud)
+void flow_add_arc(FlowNetwork* net, int* fill, int from, int to, int64_t capacity, float cost, int edge) {
+    int a = fill[from]++;
+    int b = fill[to]++;
+    net->to[a] = to;
+    net->rev[a] = b;
+    net->edge[a] = edge;
+    net->capacity[a] = capacity;
+    net->cost[a] = cost;
+    net->to[b] = from;
+    net->rev[b] = a;
+    net->edge[b] = -1;
+    net->capacity[b] = 0;
+    net->cost[b] = -cost;
+}
 
-    // Copier la première moitié du chemin du parent1
-    for (int i = 0; i < V / 2; i++) {
-        child->path[i] = parent1->path[i];
-        visited[parent1->path[i]] = true;
+// Fonction pour construire le réseau de flot d'un graphe CSR (arcs filtrés exclus)
+// Capacités : road_capacity(roadType) pour les routes, Node.capacity pour les sommets
+// (0 ou négative : non limitée). Coûts : EdgeAttr.cost par unité de fret, nul à travers un sommet.
+FlowNetwork* build_flow_network(const CSRGraph* csr) {
+    FlowNetwork* net = (FlowNetwork*)malloc(sizeof(FlowNetwork));
+    int V = csr->V;
+    int N = 2 * V;
+    net->N = N;
+
+    // Degré de chaque nœud dédoublé
+    net->first = (int*)calloc(N + 1, sizeof(int));
+    for (int v = 0; v < V; v++) {
+        net->first[2 * v + 1]++;     // arc interne (entrée)
+        net->first[2 * v + 2]++;     // arc interne (sortie, inverse)
+        for (int a = csr->offsets[v]; a < csr->offsets[v + 1]; a++) {
+            if (CSR_ARC_ALLOWED(csr, a)) {
+                net->first[2 * v + 2]++;                  // sortie(v) -> entrée(w)
+                net->first[2 * csr->targets[a] + 1]++;    // inverse
+            }
+        }
     }
-
-    // Compléter avec les sommets restants du parent2
-    int index = V / 2;
-    for (int i = 0; i < V; i++) {
-        if (!visited[parent2->path[i]]) {
-            child->path[index++] = parent2->path[i];
+    for (int i = 0; i < N; i++) {
+        net->first[i + 1] += net->first[i];
+    }
+    int M = net->first[N];
+    net->M = M;
+
+    net->to = (int*)malloc((M + 1) * sizeof(int));
+    net->rev = (int*)malloc((M + 1) * sizeof(int));
+    net->edge = (int*)malloc((M + 1) * sizeof(int));
+    net->capacity = (int64_t*)malloc((M + 1) * sizeof(int64_t));
+    net->residual = (int64_t*)malloc((M + 1) * sizeof(int64_t));
+    net->cost = (float*)malloc((M + 1) * sizeof(float));
+
+    int* fill = (int*)malloc((N + 1) * sizeof(int));
+    memcpy(fill, net->first, N * sizeof(int));
+    for (int v = 0; v < V; v++) {
+        int64_t nodeCapacity = (csr->nodeCapacity[v] > 0) ? csr->nodeCapacity[v] : MAXFLOW_UNLIMITED;
+        flow_add_arc(net, fill, 2 * v, 2 * v + 1, nodeCapacity, 0.0f, -1);
+        for (int a = csr->offsets[v]; a < csr->offsets[v + 1]; a++) {
+            if (CSR_ARC_ALLOWED(csr, a)) {
+                flow_add_arc(net, fill, 2 * v + 1, 2 * csr->targets[a], road_capacity(csr->roadType[a]),
+                             csr->cost[a], csr->edge_ids[a]);
+            }
         }
     }
-
-    free(visited);
+    free(fill);
+
+    net->label = (int*)malloc((N + 1) * sizeof(int));
+    net->current = (int*)malloc((N + 1) * sizeof(int));
+    net->excess = (int64_t*)malloc((N + 1) * sizeof(int64_t));
+    net->count = (int*)malloc((2 * N + 2) * sizeof(int));
+    net->queue = (int*)malloc((N + 1) * sizeof(int));
+    net->active = (bool*)malloc((N + 1) * sizeof(bool));
+    net->role = (unsigned char*)malloc((N + 1) * sizeof(unsigned char));
+    net->heap = create_min_heap(N + 1);
+    net->potential = (float*)malloc((N + 1) * sizeof(float));
+    net->dist = (float*)malloc((N + 1) * sizeof(float));
+    net->parentArc = (int*)malloc((N + 1) * sizeof(int));
+    for (int u = 0; u < N; u++) {
+        net->dist[u] = FLT_MAX;
+    }
+    return net;
 }
 
-// Fonction pour effectuer une mutation sur un individu
-void mutate(Individual* individual, int V) {
-    int i = rand() % V;
-    int j = rand() % V;
-
-    // Échanger deux sommets
-    int temp = individual->path[i];
-    individual->path[i] = individual->path[j];
-    individual->path[j] = temp;
+// Fonction pour libérer un réseau de flot
+void free_flow_network(FlowNetwork* net) {
+    free(net->first);
+    free(net->to);
+    free(net->rev);
+    free(net->edge);
+    free(net->capacity);
+    free(net->residual);
+    free(net->cost);
+    free(net->label);
+    free(net->current);
+    free(net->excess);
+    free(net->count);
+    free(net->queue);
+    free(net->active);
+    free(net->role);
+    free_min_heap(net->heap);
+    free(net->potential);
+    free(net->dist);
+    free(net->parentArc);
+    free(net);
 }
 
-// Algorithme génétique pour résoudre le TSP
-void genetic_tsp(Graph* graph, int population_size, int generations) {
-    int V = graph->V;
-
-    // Calculer la matrice des distances avec Floyd-Warshall
-    float** dist = (float**)malloc(V * sizeof(float*));
-    for (int i = 0; i < V; i++) {
-        dist[i] = (float*)malloc(V * sizeof(float));
+// Résultat d'un calcul de flot maximal
+typedef struct MaxFlowResult {
+    int64_t flow;                 // valeur du flot maximal
+    int* cutEdges;                // arêtes (edge_id du CSR) de la coupe minimale, une entrée par sens coupé
+    int cutEdgeCount;
+    int* cutNodes;                // sommets dont la capacité fait partie de la coupe minimale
+    int cutNodeCount;
+} MaxFlowResult;
+
+// Fonction pour réétiqueter tous les nœuds par leur distance résiduelle aux puits (parcours inverse)
+// Les nœuds qui n'atteignent plus aucun puits, et les sources, reçoivent l'étiquette N.
+// Reconstruit aussi les compteurs d'étiquettes et la file des nœuds actifs.
+void flow_global_relabel(FlowNetwork* net, int* queueHead, int* queueTail) {
+    int N = net->N;
+    int* bfs = net->queue;
+    int head = 0, tail = 0;
+    for (int u = 0; u < N; u++) {
+        net->label[u] = N;
+        net->current[u] = net->first[u];
+        net->active[u] = false;
+        if (net->role[u] == FLOW_SINK) {
+            net->label[u] = 0;
+            bfs[tail++] = u;
+        }
+    }
+    while (head < tail) {
+        int v = bfs[head++];
+        for (int a = net->first[v]; a < net->first[v + 1]; a++) {
+            int u = net->to[a];
+            // u peut envoyer vers v si l'arc inverse u -> v a une capacité résiduelle
+            if (net->label[u] == N && net->role[u] != FLOW_SOURCE && net->residual[net->rev[a]] > 0) {
+                net->label[u] = net->label[v] + 1;
+                bfs[tail++] = u;
+            }
+        }
     }
-    floyd_warshall(graph, dist);
 
-    // Initialiser la population
-    Individual* population = (Individual*)malloc(population_size * sizeof(Individual));
-    for (int i = 0; i < population_size; i++) {
-        population[i].path = (int*)malloc(V * sizeof(int));
-        generate_random_individual(&population[i], V);
-        population[i].fitness = calculate_fitness(population[i].path, V, dist);
+    memset(net->count, 0, (2 * N + 2) * sizeof(int));
+    for (int u = 0; u < N; u++) {
+        net->count[net->label[u]]++;
     }
 
-    // Évolution sur plusieurs générations
-    for (int gen = 0; gen < generations; gen++) {
-        // Trier la population par fitness (coût croissant)
-        for (int i = 0; i < population_size - 1; i++) {
-            for (int j = i + 1; j < population_size; j++) {
-                if (population[i].fitness > population[j].fitness) {
-                    Individual temp = population[i];
-                    population[i] = population[j];
-                    population[j] = temp;
-                }
-            }
+    // Nœuds actifs : excédent positif et puits atteignable
+    *queueHead = 0;
+    *queueTail = 0;
+    for (int u = 0; u < N; u++) {
+        if (net->excess[u] > 0 && net->label[u] < N && net->role[u] == 0) {
+            net->active[u] = true;
+            net->queue[(*queueTail)++] = u;
         }
+    }
+}
 
-        // Croisement et mutation pour créer la nouvelle génération
-        for (int i = population_size / 2; i < population_size; i++) {
-            crossover(&population[i - population_size / 2], &population[(i + 1) % (population_size / 2)], &population[i], V);
-            if (rand() % 100 < 10) { // 10% de chance de mutation
-                mutate(&population[i], V);
-            }
-            population[i].fitness = calculate_fitness(population[i].path, V, dist);
+// Fonction pour calculer le flot maximal des sommets sources vers les sommets puits (push-relabel)
+// Variante FIFO avec réétiquetage global périodique et heuristique des trous. Seule la première
+// phase (préflot maximal) est calculée : elle suffit pour la valeur du flot et la coupe minimale.
+// Le flot traverse la capacité des sources et des puits. result->cutEdges et result->cutNodes
+// sont alloués par la fonction (free_max_flow_result). Retourne false, sans modifier les
+// capacités résiduelles, si une source ou un puits est hors limites ou si un sommet est à la
+// fois source et puits.
+bool max_flow(FlowNetwork* net, const int* sources, int sourceCount, const int* sinks, int sinkCount,
+              MaxFlowResult* result) {
+    int N = net->N;
+    int V = N / 2;
+    result->flow = 0;
+    result->cutEdges = NULL;
+    result->cutEdgeCount = 0;
+    result->cutNodes = NULL;
+    result->cutNodeCount = 0;
+
+    if (sourceCount < 1 || sinkCount < 1) {
+        fprintf(stderr, "Erreur : Le flot demande au moins une source et un puits.\n");
+        return false;
+    }
+    for (int i = 0; i < sourceCount; i++) {
+        if (sources[i] < 0 || sources[i] >= V) {
+            fprintf(stderr, "Erreur : Source %d hors limites (%d sommets).\n", sources[i], V);
+            return false;
         }
     }
-
-    // Afficher le meilleur chemin
-    printf("Chemin optimal (algorithme génétique) : ");
-    for (int i = 0; i < V; i++) {
-        printf("%d -> ", population[0].path[i]);
+    for (int i = 0; i < sinkCount; i++) {
+        if (sinks[i] < 0 || sinks[i] >= V) {
+            fprintf(stderr, "Erreur : Puits %d hors limites (%d sommets).\n", sinks[i], V);
+            return false;
+        }
     }
-    printf("%d\n", population[0].path[0]);
-    printf("Coût minimal : %.2f\n", population[0].fitness);
 
-    // Libérer la mémoire
-    for (int i = 0; i < population_size; i++) {
-        free(population[i].path);
+    // Rôles des nœuds (remis à zéro à chaque appel) : un sommet source et puits est refusé
+    memset(net->role, 0, N * sizeof(unsigned char));
+    for (int i = 0; i < sinkCount; i++) {
+        net->role[2 * sinks[i] + 1] = FLOW_SINK;
     }
-    free(population);
-    for (int i = 0; i < V; i++) {
-        free(dist[i]);
+    for (int i = 0; i < sourceCount; i++) {
+        if (net->role[2 * sources[i] + 1] == FLOW_SINK) {
+            fprintf(stderr, "Erreur : Le sommet %d est à la fois source et puits.\n", sources[i]);
+            memset(net->role, 0, N * sizeof(unsigned char));
+            return false;
+        }
+        net->role[2 * sources[i]] = FLOW_SOURCE;
     }
-    free(dist);
-}
 
-// Fonction pour générer un graphe aléatoire
-Graph* generate_random_graph(int num_nodes, int num_edges) {
-    Graph* graph = create_graph(num_nodes);
+    memcpy(net->residual, net->capacity, net->M * sizeof(int64_t));
+    memset(net->excess, 0, N * sizeof(int64_t));
+
+    // Saturer les arcs sortant des sources (entrées des sommets sources)
+    for (int i = 0; i < sourceCount; i++) {
+        int s = 2 * sources[i];
+        for (int a = net->first[s]; a < net->first[s + 1]; a++) {
+            int64_t delta = net->residual[a];
+            if (delta > 0) {
+                net->residual[a] = 0;
+                net->residual[net->rev[a]] += delta;
+                net->excess[net->to[a]] += delta;
+                net->excess[s] -= delta;
+            }
+        }
+    }
 
-    srand(time(NULL)); // Initialiser le générateur de nombres aléatoires
+    int head, tail;
+    flow_global_relabel(net, &head, &tail);
 
-    for (int i = 0; i < num_edges; i++) {
-        int src = rand() % num_nodes;
-        int dest = rand() % num_nodes;
+    int relabels = 0;
+    while (head != tail) {
+        int u = net->queue[head];
+        head = (head + 1) % (N + 1);
+        net->active[u] = false;
+        if (net->label[u] >= N) {
+            continue;
+        }
 
-        // Éviter les boucles et les doublons
-        if (src == dest) continue;
+        // Décharger u : pousser tant qu'il reste un excédent
+        while (net->excess[u] > 0 && net->label[u] < N) {
+            int a = net->current[u];
+            if (a == net->first[u + 1]) {
+                // Réétiquetage : plus petite étiquette voisine accessible + 1
+                int old = net->label[u];
+                int best = 2 * N;
+                for (int b = net->first[u]; b < net->first[u + 1]; b++) {
+                    if (net->residual[b] > 0 && net->label[net->to[b]] + 1 < best) {
+                        best = net->label[net->to[b]] + 1;
+                    }
+                }
+                net->count[old]--;
+                net->label[u] = (best < N) ? best : N;
+                net->count[net->label[u]]++;
+                net->current[u] = net->first[u];
+                relabels++;
+
+                // Heuristique des trous : plus aucun nœud à l'étiquette old, ceux au-dessus sont écartés
+                if (net->count[old] == 0 && old < N) {
+                    for (int w = 0; w < N; w++) {
+                        if (net->label[w] > old && net->label[w] < N) {
+                            net->count[net->label[w]]--;
+                            net->label[w] = N;
+                            net->count[N]++;
+                        }
+                    }
+                }
+                continue;
+            }
 
-        EdgeAttr attr;
-        attr.distance = (float)(rand() % 100 + 1); // Distance entre 1 et 100 km
-        attr.baseTime = (float)(rand() % 120 + 10); // Temps entre 10 et 120 minutes
-        attr.cost = (float)(rand() % 1000 + 100); // Coût entre 100 et 1000 unités
-        attr.roadType = rand() % 2; // Type de route : 0 ou 1
-        attr.reliability = (float)(rand() % 100) / 100.0; // Fiabilité entre 0.0 et 1.0
-        attr.restrictions = rand() % 4; // Restrictions codées en bits
+            int v = net->to[a];
+            if (net->residual[a] > 0 && net->label[u] == net->label[v] + 1) {
+                int64_t delta = (net->excess[u] < net->residual[a]) ? net->excess[u] : net->residual[a];
+                net->residual[a] -= delta;
+                net->residual[net->rev[a]] += delta;
+                net->excess[u] -= delta;
+                net->excess[v] += delta;
+                if (!net->active[v] && net->role[v] == 0 && net->label[v] < N) {
+                    net->active[v] = true;
+                    net->queue[tail] = v;
+                    tail = (tail + 1) % (N + 1);
+                }
+            } else {
+                net->current[u]++;
+            }
+        }
+
+        // Réétiquetage global périodique (les étiquettes locales dérivent de la distance réelle)
+        if (relabels >= N) {
+            relabels = 0;
+            flow_global_relabel(net, &head, &tail);
+        }
+    }
 
-        add_edge(graph, src, dest, attr);
+    // Valeur du flot : excédent reçu par les puits
+    for (int u = 0; u < N; u++) {
+        if (net->role[u] == FLOW_SINK) {
+            result->flow += net->excess[u];
+        }
     }
 
-    return graph;
+    // Coupe minimale : nœuds qui n'atteignent plus aucun puits dans le réseau résiduel
+    flow_global_relabel(net, &head, &tail);
+    int cutEdgeCount = 0;
+    int cutNodeCount = 0;
+    for (int u = 0; u < N; u++) {
+        if (net->label[u] < N) {
+            continue;
+        }
+        for (int a = net->first[u]; a < net->first[u + 1]; a++) {
+            if (net->capacity[a] > 0 && net->label[net->to[a]] < N) {
+                if (net->edge[a] >= 0) {
+                    cutEdgeCount++;
+                } else {
+                    cutNodeCount++;
+                }
+            }
+        }
+    }
+    result->cutEdges = (int*)malloc((cutEdgeCount + 1) * sizeof(int));
+    result->cutNodes = (int*)malloc((cutNodeCount + 1) * sizeof(int));
+    for (int u = 0; u < N; u++) {
+        if (net->label[u] < N) {
+            continue;
+        }
+        for (int a = net->first[u]; a < net->first[u + 1]; a++) {
+            if (net->capacity[a] > 0 && net->label[net->to[a]] < N) {
+                if (net->edge[a] >= 0) {
+                    result->cutEdges[result->cutEdgeCount++] = net->edge[a];
+                } else {
+                    result->cutNodes[result->cutNodeCount++] = u / 2;
+                }
+            }
+        }
+    }
+    return true;
 }
 
-// Fonction pour générer et sauvegarder un graphe dans un fichier JSON
-void generate_and_save_graph_to_json(const char* filename, int num_nodes, int num_edges) {
-    Graph* graph = generate_random_graph(num_nodes, num_edges);
+// Fonction pour libérer les tableaux d'un résultat de flot maximal
+void free_max_flow_result(MaxFlowResult* result) {
+    free(result->cutEdges);
+    free(result->cutNodes);
+}
 
-    // Sauvegarder le graphe dans un fichier JSON
-    save_graph_to_json(graph, filename);
+// Résultat d'un calcul de flot de coût minimal
+typedef struct MinCostFlowResult {
+    int64_t flow;                 // quantité acheminée des offres vers les demandes
+    int64_t unmet;                // demande restée non satisfaite (offre ou capacités insuffisantes)
+    double cost;                  // coût total (flot × coût unitaire de chaque route)
+    int64_t* arcFlow;             // flot porté par chaque arc du CSR (A ; 0 pour un arc filtré)
+} MinCostFlowResult;
+
+// Fonction pour calculer un flot de coût minimal des sommets offreurs vers les sommets demandeurs
+// supply[v] > 0 : quantité disponible en v ; supply[v] < 0 : quantité demandée en v (V entrées).
+// Plus courts chemins successifs avec potentiels : chaque tour est un Dijkstra multi-sources sur
+// les coûts réduits, depuis tous les nœuds excédentaires à la fois, arrêté dès que la distance
+// dépasse celle D du premier nœud demandeur fixé. Le flot n'est poussé, le long de l'arbre, que
+// vers les nœuds demandeurs à la distance D : ce sont des plus courts chemins vers un puits
+// fictif relié à tous les demandeurs, et les arcs de l'arbre gardent un coût réduit nul après
+// mise à jour des potentiels. Pousser vers un demandeur plus lointain tant qu'un plus proche
+// reste à servir créerait un cycle négatif par ce puits : le flot livré, même partiel, est donc
+// de coût minimal pour sa quantité. Les offres et demandes traversent la capacité de leur
+// sommet. result->arcFlow est alloué par la fonction (free_min_cost_flow_result).
+bool min_cost_flow(const CSRGraph* csr, FlowNetwork* net, const int* supply, MinCostFlowResult* result) {
+    int N = net->N;
+    result->flow = 0;
+    result->unmet = 0;
+    result->cost = 0.0;
+    result->arcFlow = NULL;
+
+    for (int a = 0; a < net->M; a++) {
+        if (net->capacity[a] > 0 && net->cost[a] < 0) {
+            fprintf(stderr, "Erreur : Coût négatif sur l'arête %d.\n", net->edge[a]);
+            return false;
+        }
+    }
 
-    printf("Graphe généré et sauvegardé dans le fichier '%s'.\n", filename);
+    memcpy(net->residual, net->capacity, net->M * sizeof(int64_t));
+    memset(net->excess, 0, N * sizeof(int64_t));
+    memset(net->role, 0, N * sizeof(unsigned char));
+    int deficitNodes = 0;          // nœuds demandeurs encore atteignables (rôle FLOW_SINK)
+    for (int v = 0; v < csr->V; v++) {
+        if (supply[v] > 0) {
+            net->excess[2 * v] = supply[v];
+        } else if (supply[v] < 0) {
+            net->excess[2 * v + 1] = supply[v];
+            net->role[2 * v + 1] = FLOW_SINK;
+            deficitNodes++;
+        }
+    }
+    for (int u = 0; u < N; u++) {
+        net->potential[u] = 0.0f;
+        net->active[u] = false;    // nœud fixé par le Dijkstra du tour
+    }
 
-    free_graph(graph);
-}
+    MinHeap* heap = net->heap;
+    while (deficitNodes > 0) {
+        // Dijkstra multi-sources sur les coûts réduits
+        for (int u = 0; u < N; u++) {
+            if (net->excess[u] > 0) {
+                net->dist[u] = 0.0f;
+                net->parentArc[u] = -1;
+                heap_push_or_decrease(heap, u, 0.0f);
+            }
+        }
+        int settledCount = 0;
+        int settledDeficits = 0;
+        float reach = 0.0f;        // distance D du premier nœud demandeur fixé (dernier nœud fixé avant lui)
+        while (heap->size > 0) {
+            int u = heap->heap[0];
+            if (settledDeficits > 0 && heap->key[u] > reach) {
+                break; // tous les nœuds demandeurs à la distance D sont fixés
+            }
+            heap_pop(heap);
+            net->active[u] = true;
+            net->queue[settledCount++] = u;
+            if (settledDeficits == 0) {
+                reach = net->dist[u];
+            }
+            if (net->role[u] == FLOW_SINK) {
+                settledDeficits++;
+            }
+            for (int a = net->first[u]; a < net->first[u + 1]; a++) {
+                int v = net->to[a];
+                if (net->residual[a] <= 0 || net->active[v]) {
+                    continue;
+                }
+                float reduced = net->cost[a] + net->potential[u] - net->potential[v];
+                if (reduced < 0.0f) {
+                    reduced = 0.0f; // erreur d'arrondi : les coûts réduits sont positifs en exact
+                }
+                float candidate = net->dist[u] + reduced;
+                if (candidate < net->dist[v]) {
+                    net->dist[v] = candidate;
+                    net->parentArc[v] = a;
+                    heap_push_or_decrease(heap, v, candidate);
+                }
+            }
+        }
 
-// Fonction pour générer des jeux de données de test et les sauvegarder dans des fichiers JSON
-void generate_test_datasets_to_json() {
-    printf("Génération des jeux de données et sauvegarde dans des fichiers JSON...\n");
+        // Les nœuds excédentaires n'atteignent jamais plus de nœuds qu'au tour précédent (une poussée
+        // ne crée que des arcs inverses vers eux) : un nœud demandeur non atteint est abandonné.
+        if (heap->size == 0) {
+            for (int u = 0; u < N; u++) {
+                if (net->role[u] == FLOW_SINK && !net->active[u]) {
+                    net->role[u] = 0;
+                    deficitNodes--;
+                }
+            }
+        }
+        heap_clear(heap);
 
-    // Petit réseau (10-20 nœuds)
-    printf("\nPetit réseau (10-20 nœuds) :\n");
-    generate_and_save_graph_to_json("small_graph.json", 15, 30);
+        // Pousser le long de l'arbre vers chaque nœud demandeur fixé (tous à la distance D)
+        for (int i = 0; i < settledCount; i++) {
+            int t = net->queue[i];
+            if (net->role[t] != FLOW_SINK) {
+                continue;
+            }
+            int64_t delta = -net->excess[t];
+            int s = t;
+            while (net->parentArc[s] >= 0) {
+                int a = net->parentArc[s];
+                if (net->residual[a] < delta) {
+                    delta = net->residual[a];
+                }
+                s = net->to[net->rev[a]];
+            }
+            if (net->excess[s] < delta) {
+                delta = net->excess[s];
+            }
+            if (delta <= 0) {
+                continue; // chemin saturé par une poussée précédente de ce tour
+            }
+            for (int v = t; v != s; v = net->to[net->rev[net->parentArc[v]]]) {
+                int a = net->parentArc[v];
+                net->residual[a] -= delta;
+                net->residual[net->rev[a]] += delta;
+            }
+            net->excess[s] -= delta;
+            net->excess[t] += delta;
+            result->flow += delta;
+            if (net->excess[t] == 0) {
+                net->role[t] = 0;
+                deficitNodes--;
+            }
+        }
 
-    // Réseau moyen (100-150 nœuds)
-    printf("\nRéseau moyen (100-150 nœuds) :\n");
-    generate_and_save_graph_to_json("medium_graph.json", 120, 300);
+        // Potentiels : distance exacte pour les nœuds fixés, plafonnée à reach pour les autres
+        for (int u = 0; u < N; u++) {
+            net->potential[u] += net->active[u] ? net->dist[u] : reach;
+            net->dist[u] = FLT_MAX;
+            net->active[u] = false;
+        }
+        if (settledDeficits == 0) {
+            break; // plus aucun nœud demandeur atteignable
+        }
+    }
 
-    // Grand réseau (200+ nœuds)
-    printf("\nGrand réseau (200+ nœuds) :\n");
-    generate_and_save_graph_to_json("large_graph.json", 250, 1000);
-}
+    for (int u = 0; u < N; u++) {
+        if (net->excess[u] < 0) {
+            result->unmet -= net->excess[u];
+        }
+    }
 
-// Fonction pour appliquer un scénario au graphe
-void apply_scenario(Graph* graph, const char* scenario) {
-    if (strcmp(scenario, "Jour normal d’activité") == 0) {
-        adjust_graph_attributes(graph, 12); // Exemple : ajuster pour midi
-    } else if (strcmp(scenario, "Période de pointe") == 0) {
-        adjust_graph_attributes(graph, 8); // Exemple : ajuster pour 8h
-    } else if (strcmp(scenario, "Situation de crise") == 0) {
-        for (int v = 0; v < graph->V; v++) {
-            AdjListNode* current = graph->array[v].head;
-            while (current != NULL) {
-                current->attr.reliability *= 0.5; // Réduire la fiabilité de moitié
-                current = current->next;
+    // Flot par arc du CSR : les arcs de la sortie 2v + 1 suivent l'arc interne inverse,
+    // dans l'ordre des arcs autorisés de v (voir build_flow_network)
+    result->arcFlow = (int64_t*)calloc(csr->A + 1, sizeof(int64_t));
+    for (int v = 0; v < csr->V; v++) {
+        int b = net->first[2 * v + 1] + 1;
+        for (int a = csr->offsets[v]; a < csr->offsets[v + 1]; a++) {
+            if (CSR_ARC_ALLOWED(csr, a)) {
+                result->arcFlow[a] = net->capacity[b] - net->residual[b];
+                result->cost += (double)result->arcFlow[a] * net->cost[b];
+                b++;
             }
         }
     }
+    return true;
+}
+
+// Fonction pour libérer les tableaux d'un résultat de flot de coût minimal
+void free_min_cost_flow_result(MinCostFlowResult* result) {
+    free(result->arcFlow);
+}
+
+// Fonction pour vérifier le flot de coût minimal quand la demande ne peut pas être satisfaite
+// Réseau de 5 sommets où seules 355 unités peuvent être livrées : le flot optimal pour cette
+// quantité coûte 4515 (servir d'abord le demandeur 1, le plus proche, puis le demandeur 2).
+bool check_min_cost_flow_partial_demand(void) {
+    static const int edges[4][4] = {   // source, destination, roadType, coût
+        {0, 1, 3, 12},                 // capacité 100
+        {1, 3, 0, 13},                 // capacité 1000
+        {2, 4, 3, 8},                  // capacité 100
+        {3, 4, 1, 9}                   // capacité 400
+    };
+    static const int supply[5] = {542, -1088, -675, 255, 0};
+
+    Graph* graph = create_graph(5);
+    for (int i = 0; i < 4; i++) {
+        EdgeAttr attr;
+        memset(&attr, 0, sizeof(EdgeAttr));
+        attr.roadType = edges[i][2];
+        attr.cost = (float)edges[i][3];
+        attr.reliability = 1.0f;
+        set_default_time_variation(&attr);
+        add_edge(graph, edges[i][0], edges[i][1], attr);
+    }
+    CSRGraph* csr = build_csr_graph(graph);
+    FlowNetwork* net = build_flow_network(csr);
+    MinCostFlowResult result;
+    bool ok = min_cost_flow(csr, net, supply, &result) && result.flow == 355 && result.cost == 4515.0;
+    printf("Flot de coût minimal (demande partielle) : %lld unités, coût %.0f (attendu : 355, 4515)\n",
+           (long long)result.flow, result.cost);
+    if (!ok) {
+        fprintf(stderr, "Erreur : Flot de coût minimal non optimal pour la quantité livrée.\n");
+    }
+
+    free_min_cost_flow_result(&result);
+    free_flow_network(net);
+    free_csr_graph(csr);
+    free_graph(graph);
+    return ok;
 }
 
 // Exemple d'utilisation
@@ -1106,7 +5834,35 @@ int main() {
     apply_scenario(test_graph, "Situation de crise");
     print_graph(test_graph);
 
+    // Évaluer en parallèle les scénarios décrits dans scenarios.json sur le réseau de démonstration
+    Graph* network = load_graph_from_json("network.json");
+    int scenarioCount = 0;
+    Scenario* scenarios = load_scenarios_from_json("scenarios.json", &scenarioCount);
+    if (network != NULL && scenarios != NULL) {
+        CSRGraph* csr = build_csr_graph(network);
+        RouteQuery queries[] = { {0, 1}, {0, 2}, {1, 2} };
+        int queryCount = sizeof(queries) / sizeof(queries[0]);
+        float* results = (float*)malloc(scenarioCount * queryCount * sizeof(float));
+
+        run_scenario_batch(csr, scenarios, scenarioCount, queries, queryCount, NULL, results);
+        print_scenario_batch_results(scenarios, scenarioCount, queries, queryCount, results);
+
+        free(results);
+        free_csr_graph(csr);
+    }
+    if (scenarios != NULL) {
+        free_scenarios(scenarios, scenarioCount);
+    }
+    if (network != NULL) {
+        free_graph(network);
+    }
+
     free_graph(test_graph);
 
+    // Vérification du flot de coût minimal sur un cas à demande partielle
+    if (!check_min_cost_flow_partial_demand()) {
+        return 1;
+    }
+
     return 0;
 }
\ No newline at end of file